@@ -0,0 +1,152 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+#include <span>
+#include <vector>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The working days of a range of years - Weekends and holidays are not
+///   business days, e.g:
+///     auto calendar = BusinessCalendar(2000, 2100);
+///     calendar.AddHolidays(holidays);
+///     auto settlement = calendar.AddBusinessDays(tradeDate, 2);
+///
+///   The days are a packed bitset (one bit per day, set for business days)
+///   with the number of business days before each 64 bits word. So counting
+///   the business days before any day is a lookup and a popcount, and
+///   finding the n-th business day is a search over the counts (starting
+///   next to the given day) plus a bit select in a single word.
+///
+///   Only the date of the DateTimes matters (the wall clock date for Local
+///   ones) and the results keep their time of day and kind. Dates outside
+///   the years of the calendar throw std::out_of_range.
+///
+///   A const BusinessCalendar can be queried by any number of threads.
+class BusinessCalendar
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Weekend masks - Bit n is the n-th day of week (Sunday is 0).
+    static constexpr std::uint8_t SaturdayAndSunday = (1 << 6) | (1 << 0);
+    static constexpr std::uint8_t FridayAndSaturday = (1 << 5) | (1 << 6);
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new calendar for the years [firstYear, lastYear]
+    ///   where every day not in the weekend mask is a business day.
+    ///   Throws std::invalid_argument if lastYear is before firstYear.
+    BusinessCalendar(
+        time_t       firstYear,
+        time_t       lastYear,
+        std::uint8_t weekendDays = SaturdayAndSunday);
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets whether the date of the given DateTime is a business day.
+    bool IsBusinessDay(const DateTime &dateTime) const;
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Marks the dates of the given DateTimes as holidays.
+    void AddHoliday (const DateTime &dateTime) { AddHolidays(std::span<const DateTime>(&dateTime, 1)); }
+    void AddHolidays(std::span<const DateTime> dateTimes);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the given DateTime moved by count business days - Forward
+    ///   for positive counts and backwards for negative ones. Starting on
+    ///   a non business day counts from it, so adding 1 to a Saturday
+    ///   gives the Monday (and adding 0 gives the Saturday itself).
+    DateTime AddBusinessDays(const DateTime &dateTime, time_t count) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the number of business days from the date of from
+    ///   (inclusive) to the date of to (exclusive) - Negative if to is
+    ///   before from.
+    time_t BusinessDaysBetween(const DateTime &from, const DateTime &to) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the first business day after the given DateTime.
+    DateTime NextBusinessDay(const DateTime &dateTime) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the last business day before the given DateTime.
+    DateTime PreviousBusinessDay(const DateTime &dateTime) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Batch versions of the above over wall clock ticks. The outputs
+    ///   must have room for as many values as the inputs and can be the
+    ///   inputs themselves.
+    ///   Throws std::invalid_argument if the sizes don't match.
+    void AddBusinessDays(
+        std::span<const time_t> ticks,
+        time_t                  count,
+        std::span<time_t>       result) const;
+
+    void BusinessDaysBetween(
+        std::span<const time_t> from,
+        std::span<const time_t> to,
+        std::span<time_t>       result) const;
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    size_t DayIndex(time_t wallTicks) const;
+
+    // Business days before the given day.
+    size_t Rank(size_t dayIndex) const;
+
+    // Day of the given business day (0 based), searched from hintDay.
+    size_t Select(size_t rank, size_t hintDay) const;
+
+    time_t AddBusinessDaysToWallTicks(time_t wallTicks, time_t count) const;
+
+    void BuildCounts();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    time_t m_firstDay;      // Days since the Unix Epoch of the first day.
+    size_t m_dayCount;
+
+    std::vector<std::uint64_t> m_bits;
+    std::vector<std::uint32_t> m_counts;    // Business days before each word.
+};
+
+NS_CORETIME_END
@@ -0,0 +1,368 @@
+#pragma once
+
+// std
+#include <array>
+#include <cstdint>
+#include <ctime>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "TimeSpan.h"
+
+
+//----------------------------------------------------------------------------//
+// Lookup Tables Range                                                        //
+//----------------------------------------------------------------------------//
+// Years covered by the CivilCalendar lookup tables - Dates outside of it
+// use the plain arithmetic. Each year costs 4 bytes, so keep it to the
+// years that really matter to keep the tables in cache.
+#ifndef COW_CORETIME_CIVIL_TABLE_FIRST_YEAR
+    #define COW_CORETIME_CIVIL_TABLE_FIRST_YEAR 1600
+#endif
+
+#ifndef COW_CORETIME_CIVIL_TABLE_LAST_YEAR
+    #define COW_CORETIME_CIVIL_TABLE_LAST_YEAR 2400
+#endif
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The broken down representation of a point in the proleptic
+///   Gregorian calendar.
+struct CivilFields
+{
+    time_t year;
+    time_t month;       ///< [1-12]
+    time_t day;         ///< [1-31]
+    time_t hour;        ///< [0-23]
+    time_t minute;      ///< [0-59]
+    time_t second;      ///< [0-59]
+    time_t millisecond; ///< [0-999]
+    time_t dayOfWeek;   ///< [0-6] - Sunday is 0.
+    time_t dayOfYear;   ///< [1-366]
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Pure arithmetic conversions between ticks since the Unix Epoch and
+///   the proleptic Gregorian calendar.
+///
+///   Nothing here touches libc, the TZ environment or any lock, so
+///   everything can be used in constant expressions.
+///
+///   Dates between COW_CORETIME_CIVIL_TABLE_FIRST_YEAR and
+///   COW_CORETIME_CIVIL_TABLE_LAST_YEAR are converted with compile time
+///   tables of the days of each year start and each month start. The
+///   other ones use the days_from_civil / civil_from_days algorithms
+///   described by Howard Hinnant in:
+///     http://howardhinnant.github.io/date_algorithms.html
+class CivilCalendar
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Days in a 400 years cycle of the Gregorian calendar.
+    static constexpr time_t DaysPerEra = 146097;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Days between 0000-03-01 and 1970-01-01.
+    static constexpr time_t DaysFromEraStartToUnixEpoch = 719468;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The years covered by the lookup tables - Both inclusive.
+    static constexpr time_t TableFirstYear = COW_CORETIME_CIVIL_TABLE_FIRST_YEAR;
+    static constexpr time_t TableLastYear  = COW_CORETIME_CIVIL_TABLE_LAST_YEAR;
+
+    static_assert(
+        TableFirstYear <= TableLastYear,
+        "CivilCalendar - Invalid lookup tables range"
+    );
+
+private:
+    static constexpr size_t k_table_years = size_t(TableLastYear - TableFirstYear + 1);
+
+    //--------------------------------------------------------------------------
+    // [i]       - Days from 1970-01-01 to January 1st of TableFirstYear + i.
+    //             It has one more year so every year has its length.
+    // [leap][m] - Days from January 1st to the start of month m + 1.
+    // [leap][d] - Month [1-12] of the day d [0-365] of the year.
+    typedef std::array<std::int32_t, k_table_years + 1>  YearStartTable;
+    typedef std::array<std::array<std::int16_t,  13>, 2> MonthStartTable;
+    typedef std::array<std::array<std::uint8_t, 366>, 2> MonthOfDayTable;
+
+    static const YearStartTable  s_yearStarts;
+    static const MonthStartTable s_monthStarts;
+    static const MonthOfDayTable s_monthOfDay;
+
+
+    //------------------------------------------------------------------------//
+    // Integer Helpers                                                        //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Integer division rounding towards negative infinity.
+    static constexpr time_t FloorDiv(time_t value, time_t divisor)
+    {
+        return (value >= 0)
+            ? (value / divisor)
+            : ((value - divisor + 1) / divisor);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Remainder of FloorDiv - Always in [0, divisor).
+    static constexpr time_t FloorMod(time_t value, time_t divisor)
+    {
+        return value - FloorDiv(value, divisor) * divisor;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Calendar Queries                                                       //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns an indication whether the specified year is a leap year.
+    static constexpr bool IsLeapYear(time_t year)
+    {
+        //----------------------------------------------------------------------
+        // Reference:
+        //   https://en.wikipedia.org/wiki/Leap_year
+        return (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the number of days in the specified month [1-12] and year.
+    static constexpr time_t DaysInMonth(time_t month, time_t year)
+    {
+        const auto &month_starts = s_monthStarts[IsLeapYear(year)];
+        return month_starts[month] - month_starts[month - 1];
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Conversions                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the number of days between 1970-01-01 and the given date.
+    ///   Months outside [1-12] and days outside the month are normalized
+    ///   the same way that mktime(3) does.
+    static constexpr time_t DaysFromCivil(time_t year, time_t month, time_t day)
+    {
+        //----------------------------------------------------------------------
+        // Bring the month to [1-12] carrying the excess to the year.
+        if(month < 1 || month > 12)
+        {
+            year  += FloorDiv(month - 1, 12);
+            month  = FloorMod(month - 1, 12) + 1;
+        }
+
+        auto index = std::uint64_t(year - TableFirstYear);
+        if(index < k_table_years)
+        {
+            auto year_start = s_yearStarts[index];
+            auto leap       = (s_yearStarts[index + 1] - year_start == 366);
+
+            return year_start + s_monthStarts[leap][month - 1] + day - 1;
+        }
+
+        return ArithmeticDaysFromCivil(year, month, day);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the date fields of the day that is the given number of days
+    ///   after 1970-01-01. Time fields are zeroed.
+    static constexpr CivilFields CivilFromDays(time_t days)
+    {
+        auto since_first = days - s_yearStarts[0];
+        if(std::uint64_t(since_first) >= std::uint64_t(s_yearStarts.back() - s_yearStarts[0]))
+            return ArithmeticCivilFromDays(days);
+
+        //----------------------------------------------------------------------
+        // The average year length gives the year or one next to it.
+        auto index = size_t(since_first * 400 / DaysPerEra);
+        if(days < s_yearStarts[index])
+            --index;
+        else if(days >= s_yearStarts[index + 1])
+            ++index;
+
+        auto doy  = days - s_yearStarts[index];                      // [0, 365]
+        auto leap = (s_yearStarts[index + 1] - s_yearStarts[index] == 366);
+
+        auto fields      = CivilFields{};
+        fields.year      = TableFirstYear + time_t(index);
+        fields.month     = s_monthOfDay[leap][doy];
+        fields.day       = doy - s_monthStarts[leap][fields.month - 1] + 1;
+        fields.dayOfYear = doy + 1;
+
+        //----------------------------------------------------------------------
+        // 1970-01-01 was a Thursday.
+        fields.dayOfWeek = FloorMod(days + 4, 7);
+
+        return fields;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Breaks the given ticks since the Unix Epoch in its UTC fields.
+    static constexpr CivilFields DecomposeTicks(time_t ticks)
+    {
+        auto days         = FloorDiv(ticks, TimeSpan::TicksPerDay);
+        auto ticks_of_day = ticks - days * TimeSpan::TicksPerDay;
+
+        auto fields        = CivilFromDays(days);
+        fields.hour        = (ticks_of_day / TimeSpan::TicksPerHour);
+        fields.minute      = (ticks_of_day / TimeSpan::TicksPerMinute) % 60;
+        fields.second      = (ticks_of_day / TimeSpan::TicksPerSecond) % 60;
+        fields.millisecond = (ticks_of_day / TimeSpan::TicksPerMillisecond) % 1000;
+
+        return fields;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Builds the ticks since the Unix Epoch of the given UTC fields.
+    ///   Out of range fields are normalized the same way that mktime(3) does.
+    static constexpr time_t ComposeTicks(
+        time_t year,
+        time_t month,
+        time_t day,
+        time_t hour,
+        time_t minute,
+        time_t second,
+        time_t millisecond)
+    {
+        return DaysFromCivil(year, month, day) * TimeSpan::TicksPerDay
+            + hour        * TimeSpan::TicksPerHour
+            + minute      * TimeSpan::TicksPerMinute
+            + second      * TimeSpan::TicksPerSecond
+            + millisecond * TimeSpan::TicksPerMillisecond;
+    }
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    //--------------------------------------------------------------------------
+    // Expects the month in [1-12].
+    static constexpr time_t ArithmeticDaysFromCivil(time_t year, time_t month, time_t day)
+    {
+        //----------------------------------------------------------------------
+        // Shift the year to start on March so the leap day is the last one.
+        year -= (month <= 2);
+
+        auto era = FloorDiv(year, 400);
+        auto yoe = year - era * 400;                                // [0, 399]
+        auto mp  = (month > 2) ? (month - 3) : (month + 9);         // [0, 11]
+        auto doy = (153 * mp + 2) / 5 + day - 1;                    // [0, 365]
+        auto doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;           // [0, 146096]
+
+        return era * DaysPerEra + doe - DaysFromEraStartToUnixEpoch;
+    }
+
+    //--------------------------------------------------------------------------
+    static constexpr CivilFields ArithmeticCivilFromDays(time_t days)
+    {
+        auto z   = days + DaysFromEraStartToUnixEpoch;
+        auto era = FloorDiv(z, DaysPerEra);
+        auto doe = z - era * DaysPerEra;                            // [0, 146096]
+        auto yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        auto doy = doe - (365 * yoe + yoe / 4 - yoe / 100);         // [0, 365]
+        auto mp  = (5 * doy + 2) / 153;                             // [0, 11]
+
+        auto fields  = CivilFields{};
+        fields.day   = doy - (153 * mp + 2) / 5 + 1;
+        fields.month = (mp < 10) ? (mp + 3) : (mp - 9);
+        fields.year  = yoe + era * 400 + (fields.month <= 2);
+
+        //----------------------------------------------------------------------
+        // 1970-01-01 was a Thursday.
+        fields.dayOfWeek = FloorMod(days + 4, 7);
+
+        //----------------------------------------------------------------------
+        // doy counts from March 1st, rebase it to January 1st.
+        fields.dayOfYear = (fields.month > 2)
+            ? (doy + 59 + IsLeapYear(fields.year) + 1)
+            : (doy - 306 + 1);
+
+        return fields;
+    }
+
+    //--------------------------------------------------------------------------
+    static constexpr YearStartTable MakeYearStarts()
+    {
+        auto table = YearStartTable{};
+        for(size_t i = 0; i < table.size(); ++i)
+            table[i] = std::int32_t(ArithmeticDaysFromCivil(TableFirstYear + time_t(i), 1, 1));
+
+        return table;
+    }
+
+    //--------------------------------------------------------------------------
+    static constexpr MonthStartTable MakeMonthStarts()
+    {
+        //----------------------------------------------------------------------
+        // Reference:
+        //   http://memorize.com/days-in-each-month
+        constexpr std::int16_t k_month_days[] = {
+            31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
+        };
+
+        auto table = MonthStartTable{};
+        for(size_t leap = 0; leap < 2; ++leap)
+        {
+            for(size_t month = 0; month < 12; ++month)
+            {
+                //--------------------------------------------------------------
+                // Only February can change its month days.
+                table[leap][month + 1] = table[leap][month]
+                                       + k_month_days[month]
+                                       + (leap && month == 1);
+            }
+        }
+
+        return table;
+    }
+
+    //--------------------------------------------------------------------------
+    static constexpr MonthOfDayTable MakeMonthOfDay()
+    {
+        auto month_starts = MakeMonthStarts();
+        auto table        = MonthOfDayTable{};
+
+        for(size_t leap = 0; leap < 2; ++leap)
+        {
+            auto month = size_t(1);
+            for(size_t day = 0; day < 366; ++day)
+            {
+                if(month < 12 && std::int16_t(day) >= month_starts[leap][month])
+                    ++month;
+
+                table[leap][day] = std::uint8_t(month);
+            }
+        }
+
+        return table;
+    }
+};
+
+//------------------------------------------------------------------------------
+// The tables are built at compile time and are part of the binary.
+inline constexpr CivilCalendar::YearStartTable  CivilCalendar::s_yearStarts  = CivilCalendar::MakeYearStarts ();
+inline constexpr CivilCalendar::MonthStartTable CivilCalendar::s_monthStarts = CivilCalendar::MakeMonthStarts();
+inline constexpr CivilCalendar::MonthOfDayTable CivilCalendar::s_monthOfDay  = CivilCalendar::MakeMonthOfDay ();
+
+NS_CORETIME_END
@@ -0,0 +1,188 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The clocks that DateTime::Now / DateTime::UtcNow can read from.
+///   Each clock is a policy type with a static UtcTicks() that returns
+///   the ticks since the Unix Epoch, e.g:
+///     DateTime::UtcNow<ClockSource::RealtimeCoarse>();
+class ClockSource
+{
+    //------------------------------------------------------------------------//
+    // Helper Functions                                                       //
+    //------------------------------------------------------------------------//
+private:
+    static time_t ReadClock(clockid_t clockId)
+    {
+        struct timespec _timespec = {0, 0};
+        clock_gettime(clockId, &_timespec);
+
+        return _timespec.tv_sec  * TimeSpan::TicksPerSecond
+             + _timespec.tv_nsec / 100;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Clocks                                                                 //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   clock_gettime(CLOCK_REALTIME) with the full tick precision.
+    ///   This is the default clock.
+    struct Realtime
+    {
+        static time_t UtcTicks() { return ReadClock(CLOCK_REALTIME); }
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   clock_gettime(CLOCK_REALTIME_COARSE) - Much cheaper to read but
+    ///   only as precise as the kernel tick (usually 1 to 4 ms).
+    ///   Falls back to Realtime where the coarse clock doesn't exist.
+    struct RealtimeCoarse
+    {
+        static time_t UtcTicks()
+        {
+        #if defined(CLOCK_REALTIME_COARSE)
+            return ReadClock(CLOCK_REALTIME_COARSE);
+        #else
+            return ReadClock(CLOCK_REALTIME);
+        #endif
+        }
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Reads the CPU time stamp counter and rescales it to ticks, without
+    ///   any syscall. It is calibrated against CLOCK_REALTIME on the first
+    ///   read (which takes ~10ms - Call WarmUp() at startup to take it out
+    ///   of the first read) and then resynchronized with it by the first
+    ///   read after each ResyncInterval.
+    ///
+    ///   Each resynchronization snaps to CLOCK_REALTIME and measures the
+    ///   counter rate over the last interval, so the error is bounded by
+    ///   the rate error over one interval - A few hundred nanoseconds
+    ///   after the first interval (a few microseconds before it) - and
+    ///   wall clock adjustments (NTP, settimeofday) are followed within
+    ///   an interval. Like CLOCK_REALTIME itself it is not monotonic: a
+    ///   resynchronization can step back by that error.
+    ///   Falls back to Realtime when the CPU lacks an invariant TSC.
+    struct Tsc
+    {
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Maps counter values to ticks as:
+        ///     ticks = baseTicks + ((counter - baseCounter) * multiplier) >> 32
+        struct Calibration
+        {
+            bool          isReliable;
+            std::uint64_t baseCounter;
+            time_t        baseTicks;
+            std::uint64_t multiplier;
+        };
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   How often the counter is resynchronized with CLOCK_REALTIME.
+        static constexpr time_t ResyncIntervalTicks = TimeSpan::TicksPerSecond;
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Calibrates the counter if it wasn't yet (~10ms, only once) and
+        ///   returns whether it is reliable.
+        static bool WarmUp();
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Gets a consistent copy of the current calibration - It changes
+        ///   on every resynchronization.
+        static Calibration GetCalibration();
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Whether the counter (invariant TSC) can be used - Same as
+        ///   WarmUp(), so the first call pays for the calibration.
+        static bool IsReliable() { return WarmUp(); }
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Whether WarmUp() already found the counter reliable - A single
+        ///   load, for the read paths that called WarmUp() beforehand.
+        static bool IsCalibrated()
+        {
+            return s_isCalibrated.load(std::memory_order_relaxed);
+        }
+
+        static std::uint64_t ReadCounter()
+        {
+        #if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+        #else
+            return 0;
+        #endif
+        }
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   (value * multiplier) >> 32 without overflowing the product -
+        ///   Uses __int128 where the compiler has it and four 32 bit
+        ///   partial products elsewhere (e.g. i386).
+        static std::uint64_t MultiplyShift32(
+            std::uint64_t value,
+            std::uint64_t multiplier)
+        {
+        #if defined(__SIZEOF_INT128__)
+            __extension__ typedef unsigned __int128 uint128_t;
+            return std::uint64_t((uint128_t(value) * multiplier) >> 32);
+        #else
+            auto value_hi      = (value      >> 32);
+            auto value_lo      = (value      & 0xFFFFFFFF);
+            auto multiplier_hi = (multiplier >> 32);
+            auto multiplier_lo = (multiplier & 0xFFFFFFFF);
+
+            return ((value_hi * multiplier_hi) << 32)
+                 + value_hi * multiplier_lo
+                 + value_lo * multiplier_hi
+                 + ((value_lo * multiplier_lo) >> 32);
+        #endif
+        }
+
+        static time_t CounterToTicks(std::uint64_t counter)
+        {
+            auto calibration = GetCalibration();
+
+            // Signed so counters read before the calibration still work.
+            auto elapsed = std::int64_t(counter - calibration.baseCounter);
+            if(elapsed < 0)
+            {
+                return calibration.baseTicks
+                     - time_t(MultiplyShift32(std::uint64_t(-elapsed), calibration.multiplier));
+            }
+
+            return calibration.baseTicks
+                 + time_t(MultiplyShift32(std::uint64_t(elapsed), calibration.multiplier));
+        }
+
+        static time_t UtcTicks();
+
+    private:
+        inline static std::atomic<bool> s_isCalibrated { false };
+    };
+};
+
+NS_CORETIME_END
@@ -0,0 +1,137 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+#include <span>
+#include <vector>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   An append only series of ticks compressed with delta-of-delta bit
+///   packing (as in Facebook's Gorilla), e.g:
+///     auto series = CompressedTickSeries();
+///     for(const auto &sample : samples)
+///         series.Append(sample.dateTime);
+///     series.Decode(0, ticks);
+///
+///   The values are split in blocks of CheckpointInterval() values. Each
+///   block starts byte aligned with its first ticks in full, followed by
+///   the bit codes of the difference between consecutive deltas:
+///     0                    - Same delta as before.
+///     10    +  8 bits      - Zigzag of the difference.
+///     110   + 16 bits
+///     1110  + 24 bits
+///     11110 + 32 bits
+///     11111 + 64 bits
+///   The widths are larger than Gorilla's (which counts seconds), since a
+///   few milliseconds of jitter are already tens of thousands of ticks.
+///
+///   The start of each block is kept, so random access only decodes from
+///   the start of its block. Regular series cost ~1 bit per value, and
+///   runs of repeated deltas decode as a single arithmetic fill.
+///
+///   Only the ticks are stored - The DateTimeKind is up to the caller.
+class CompressedTickSeries
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new empty series with a checkpoint every given
+    ///   number of values (at least 1).
+    explicit CompressedTickSeries(size_t checkpointInterval = 1024);
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of values of the series.
+    size_t Count() const { return m_count; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of values between checkpoints.
+    size_t CheckpointInterval() const { return m_checkpointInterval; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the encoded bytes.
+    const std::vector<std::uint8_t>& Bytes() const { return m_bytes; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the memory used by the encoded bytes and the checkpoints.
+    size_t ByteSize() const
+    {
+        return m_bytes.size() + m_checkpoints.size() * sizeof(std::uint64_t);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Appends the given ticks to the end of the series.
+    void Append(time_t ticks);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Appends the ticks of the given DateTime to the end of the series.
+    void Append(const DateTime &dateTime) { Append(dateTime.Ticks()); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the ticks at the given index.
+    ///   Throws std::out_of_range if index isn't less than Count().
+    time_t At(size_t index) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Decodes ticks.size() values starting at the given index into ticks.
+    ///   Throws std::out_of_range if they go past Count().
+    void Decode(size_t first, std::span<time_t> ticks) const;
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    void WriteBits(std::uint64_t value, int count);
+
+    void DecodeBlock(
+        size_t block,
+        size_t skip,
+        size_t count,
+        time_t *ticks) const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    size_t m_checkpointInterval;
+    size_t m_count;
+
+    std::uint64_t m_prevTicks;      // Kept as unsigned so deltas can wrap.
+    std::uint64_t m_prevDelta;
+    int           m_freeBits;       // Unused low bits of the last byte.
+
+    std::vector<std::uint8_t>  m_bytes;
+    std::vector<std::uint64_t> m_checkpoints;    // Byte offset of each block.
+};
+
+NS_CORETIME_END
@@ -1,24 +1,83 @@
 #pragma once
 
 // std
+#include <chrono>
+#include <cstdint>
 #include <ctime>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 // CoreTime
 #include "CoreTime_Utils.h"
+#include "CivilCalendar.h"
+#include "ClockSource.h"
 #include "TimeSpan.h"
+#include "TimeUnit.h"
 
 NS_CORETIME_BEGIN
 
+///-----------------------------------------------------------------------------
+/// @brief
+///   Represents an instant in time, typically expressed as a date and
+///   time of day.
+///
+///   A DateTime is a single 64 bits word (the ticks and the kind) without
+///   any cache or mutable state - Every getter computes its result from
+///   that word alone. So a const DateTime can be read by any number of
+///   threads at once, with no copies and no locks. Local DateTimes also
+///   read TimeZone::Local(), which is safe for concurrent use as well.
 class DateTime
 {
     //------------------------------------------------------------------------//
     // Enums / Constants / Typedefs                                           //
     //------------------------------------------------------------------------//
 public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   What the ticks of a DateTime are:
+    ///     Local - UTC ticks, shown at the wall clock of TimeZone::Local().
+    ///     UTC   - UTC ticks, shown as they are.
+    ///     None  - The ticks of a wall clock of no zone in particular (e.g.
+    ///             a parsed string without offset), shown as they are.
+    ///   Wherever an instant is needed (ToUniversalTime, ToLocalTime,
+    ///   ToSysTime, ...) the ticks of None DateTimes are taken as UTC - Use
+    ///   TimeZone::ConvertToUtc to take them as the wall clock of a zone.
     enum class DateTimeKind { Local, UTC, None };
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The units of Floor, Ceil and Round. Up to Day they are plain
+    ///   multiples of ticks, Week is the ISO week (starting on Monday) and
+    ///   the others follow the calendar.
+    enum class DateTimeUnit
+    {
+        Tick, Millisecond, Second, Minute, Hour, Day,
+        Week, Month, Quarter, Year
+    };
+
     typedef struct tm tm_t;
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The std::chrono time points with the same representation as
+    ///   DateTime ticks - Converting between them is a plain integer copy.
+    typedef std::chrono::sys_time  <TimeSpan::duration_t> sys_time_t;
+    typedef std::chrono::local_time<TimeSpan::duration_t> local_time_t;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The DateTimeKind is packed in the 2 topmost bits of the ticks,
+    ///   so the ticks must fit in 62 bits - From -5337-01-28 05:17:58.630
+    ///   to 9276-12-03 18:42:01.369. Constructing a DateTime outside of it
+    ///   (directly or with Add*, Floor, Ceil, ...) throws std::out_of_range.
+    ///
+    ///   Notice that 9999-12-31 (DateTime.MaxValue of .NET and the usual
+    ///   "no end" sentinel of databases) is past MaxTicks - Such sentinels
+    ///   must be mapped to MaxTicks by the caller.
+    static constexpr time_t MinTicks = -(time_t(1) << 61);
+    static constexpr time_t MaxTicks =  (time_t(1) << 61) - 1;
+
 
     //------------------------------------------------------------------------//
     // CTOR / DTOR                                                            //
@@ -29,7 +88,9 @@ public:
     ///   Initializes a new instance of the DateTime structure to the
     ///   specified year, month, day, hour, minute, second, millisecond,
     ///   and Coordinated Universal Time (UTC) or local time.
-    DateTime(
+    ///   Throws std::out_of_range if the date is outside of
+    ///   [MinTicks, MaxTicks].
+    constexpr DateTime(
         time_t       year,
         time_t       month,
         time_t       day,
@@ -43,10 +104,42 @@ public:
     /// @brief
     ///   Initializes a new instance of the DateTime structure to a specified
     ///   number of ticks and to Coordinated Universal Time (UTC) or local time.
-    explicit DateTime(
+    ///   Throws std::out_of_range if the ticks are outside of
+    ///   [MinTicks, MaxTicks].
+    explicit constexpr DateTime(
         time_t       ticks,
         DateTimeKind kind = DateTimeKind::UTC);
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new UTC instance of the DateTime structure to the
+    ///   given std::chrono::sys_time. Time points finer than a tick are
+    ///   rounded down.
+    template <typename TDuration>
+    explicit constexpr DateTime(const std::chrono::sys_time<TDuration> &sysTime) :
+        DateTime(
+            std::chrono::floor<TimeSpan::duration_t>(sysTime.time_since_epoch()).count(),
+            DateTimeKind::UTC
+        )
+    {
+        // Empty...
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new DateTimeKind::None instance of the DateTime
+    ///   structure to the given std::chrono::local_time. Time points finer
+    ///   than a tick are rounded down.
+    template <typename TDuration>
+    explicit constexpr DateTime(const std::chrono::local_time<TDuration> &localTime) :
+        DateTime(
+            std::chrono::floor<TimeSpan::duration_t>(localTime.time_since_epoch()).count(),
+            DateTimeKind::None
+        )
+    {
+        // Empty...
+    }
+
 
     //------------------------------------------------------------------------//
     // Getters                                                                //
@@ -55,45 +148,54 @@ public:
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the day of the month represented by this instance.
-    time_t Day() const;
+    constexpr time_t Day() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the day of the week represented by this instance.
-    time_t DayOfWeek() const;
+    constexpr time_t DayOfWeek() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///  Gets the day of the year represented by this instance.
-    time_t DayOfYear() const;
+    constexpr time_t DayOfYear() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets all the calendar fields of this instance at once.
+    ///   Prefer this (or DecomposedDateTime) over calling several
+    ///   single field getters in a row.
+    ///   Only Local DateTimes need the time zone - Every field of UTC and
+    ///   DateTimeKind::None DateTimes can be computed at compile time.
+    constexpr CivilFields Fields() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the hour component of the date represented by this instance.
-    time_t Hour() const;
+    constexpr time_t Hour() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets a value that indicates whether the time represented by
     ///   this instance is based on local time,
     ///   Coordinated Universal Time (UTC), or neither.
-    DateTimeKind Kind() const;
+    constexpr DateTimeKind Kind() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     /// Gets the milliseconds component of the date represented
     /// by this instance.
-    time_t Millisecond() const;
+    constexpr time_t Millisecond() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the minute component of the date represented by this instance.
-    time_t Minute() const;
+    constexpr time_t Minute() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the month component of the date represented by this instance.
-    time_t Month() const;
+    constexpr time_t Month() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
@@ -101,25 +203,35 @@ public:
     ///  this computer, expressed as the local time.
     static DateTime Now();
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as Now() but reading the given ClockSource.
+    template <typename TClockSource>
+    static DateTime Now()
+    {
+        return DateTime(TClockSource::UtcTicks(), DateTimeKind::Local);
+    }
+
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the seconds component of the date represented by this instance.
-    time_t Second() const;
+    constexpr time_t Second() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the number of ticks that represent the date and
     ///   time of this instance.
-    time_t Ticks() const;
+    constexpr time_t Ticks() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the time of day for this instance.
-    TimeSpan TimeOfDay() const;
+    constexpr TimeSpan TimeOfDay() const;
 
     ///-------------------------------------------------------------------------
     /// @brief
-    ///  Gets the current date.
+    ///   Gets the current date - Now() at the midnight of the local wall
+    ///   clock.
     static DateTime Today();
 
     ///-------------------------------------------------------------------------
@@ -128,11 +240,20 @@ public:
     ///   on this computer, expressed as the Coordinated Universal Time (UTC).
     static DateTime UtcNow();
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as UtcNow() but reading the given ClockSource.
+    template <typename TClockSource>
+    static DateTime UtcNow()
+    {
+        return DateTime(TClockSource::UtcTicks(), DateTimeKind::UTC);
+    }
+
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the year component of the date represented by this instance.
-    time_t Year() const;
+    constexpr time_t Year() const;
 
 
     //------------------------------------------------------------------------//
@@ -143,74 +264,128 @@ public:
     /// @brief
     ///   Returns a new DateTime that adds the value of the specified
     ///   TimeSpan to the value of this instance.
-    DateTime Add(const TimeSpan &timeSpan);
+    constexpr DateTime Add(const TimeSpan &timeSpan) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns a new DateTime that adds the given whole number of units
+    ///   (Days{n}, Hours{n}, ...) to the value of this instance - It is a
+    ///   single integer multiply-add, prefer it over AddDays(double) and
+    ///   the other double overloads.
+    template <time_t TTicksPerUnit>
+    constexpr DateTime Add(const TimeUnit<TTicksPerUnit> &units) const
+    {
+        return AddTicks(units.Ticks());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as above with the unit as template parameter, e.g:
+    ///     dateTime.Add<Days>(3);
+    template <typename TUnit>
+    constexpr DateTime Add(std::int64_t count) const
+    {
+        return Add(TUnit(count));
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new DateTime that adds the specified number of days to
     ///   the value of this instance.
-    DateTime AddDays(double days);
+    constexpr DateTime AddDays(double days) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new DateTime that adds the specified number of hours to
     ///   the value of this instance.
-    DateTime AddHours(double hours);
+    constexpr DateTime AddHours(double hours) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new DateTime that adds the specified number of milliseconds
     ///   to the value of this instance.
-    DateTime AddMilliseconds(double ms);
+    constexpr DateTime AddMilliseconds(double ms) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new DateTime that adds the specified number of minutes
     ///   to the value of this instance.
-    DateTime AddMinutes(double minutes);
+    constexpr DateTime AddMinutes(double minutes) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new DateTime that adds the specified number of months to
     ///   the value of this instance.
-    DateTime AddMonths(time_t months);
+    constexpr DateTime AddMonths(time_t months) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new DateTime that adds the specified number of seconds to
     ///   the value of this instance.
-    DateTime AddSeconds(double seconds);
+    constexpr DateTime AddSeconds(double seconds) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new DateTime that adds the specified number of ticks to
     ///   the value of this instance.
-    DateTime AddTicks(time_t ticks);
+    constexpr DateTime AddTicks(time_t ticks) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new DateTime that adds the specified number of years to
     ///   the value of this instance.
-    DateTime AddYears(time_t years);
+    constexpr DateTime AddYears(time_t years) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns a new DateTime rounded up to the start of the given unit,
+    ///   e.g. the next midnight for DateTimeUnit::Day - Values already at
+    ///   the start of a unit are kept. Local DateTimes are rounded on
+    ///   their wall clock.
+    constexpr DateTime Ceil(DateTimeUnit unit) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns a new DateTime rounded up to a multiple of the given size
+    ///   since the Unix Epoch (e.g. 15 minutes buckets).
+    ///   Throws std::invalid_argument if the size isn't positive and
+    ///   std::out_of_range if the result is past MaxTicks.
+    constexpr DateTime Ceil(const TimeSpan &size) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Compares two instances of DateTime and returns an time_teger that
     ///   indicates whether the first instance is earlier than, the same as,
-    ///   or later than the second instance.
-    static time_t Compare(const DateTime &lhs, const DateTime &rhs);
+    ///   or later than the second instance - Respectively -1, 0 or 1.
+    static constexpr time_t Compare(const DateTime &lhs, const DateTime &rhs);
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Compares the value of this instance to a specified DateTime value
     ///   and returns an time_teger that indicates whether this instance is
     ///   earlier than, the same as, or later than the specified DateTime value.
-    time_t CompareTo(const DateTime &rhs) const;
+    constexpr time_t CompareTo(const DateTime &rhs) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns the number of days in the specified month and year.
-    static time_t DaysInMonth(time_t month, time_t year);
+    ///   Throws std::out_of_range if the month isn't in [1, 12].
+    static constexpr time_t DaysInMonth(time_t month, time_t year);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns a new DateTime rounded down to the start of the given
+    ///   unit, e.g. the first of the month at midnight for
+    ///   DateTimeUnit::Month. Local DateTimes are rounded on their wall
+    ///   clock.
+    constexpr DateTime Floor(DateTimeUnit unit) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns a new DateTime rounded down to a multiple of the given
+    ///   size since the Unix Epoch (e.g. 15 minutes buckets).
+    ///   Throws std::invalid_argument if the size isn't positive.
+    constexpr DateTime Floor(const TimeSpan &size) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
@@ -221,61 +396,673 @@ public:
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns an indication whether the specified year is a leap year.
-    static bool IsLeapYear(time_t year);
+    static constexpr bool IsLeapYear(time_t year);
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Converts the string representation of a date and time to
     ///   its DateTime equivalent.
+    ///   Accepts the ISO-8601 / RFC 3339 layout:
+    ///     YYYY-MM-DD[(T|t| )hh:mm:ss[(.|,)fraction][Z|z|+hh:mm[:ss]|-hh:mm[:ss]]]
+    ///   Strings with an offset (or Z) give an UTC DateTime, the ones
+    ///   without give a DateTimeKind::None one. Fractions are truncated
+    ///   to ticks and a leap second (:60) is taken as :59.
+    ///   Throws std::invalid_argument if the string isn't valid - Dates
+    ///   outside of [MinTicks, MaxTicks] aren't valid, and that includes
+    ///   the 9999-12-31T23:59:59.9999999Z sentinel.
     static DateTime Parse(const std::string &format);
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as Parse but returns false instead of throwing, leaving
+    ///   result untouched. Doesn't allocate.
+    static bool TryParse(std::string_view str, DateTime &result);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns a new DateTime rounded to the nearest start of the given
+    ///   unit - Halfway values are rounded up.
+    constexpr DateTime Round(DateTimeUnit unit) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns a new DateTime rounded to the nearest multiple of the
+    ///   given size since the Unix Epoch - Halfway values are rounded up.
+    ///   Throws std::invalid_argument if the size isn't positive and
+    ///   std::out_of_range if the result is past MaxTicks.
+    constexpr DateTime Round(const TimeSpan &size) const;
+
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Creates a new DateTime object that has the same number of
     ///   ticks as the specified DateTime, but is designated as either
     ///   local time, Coordinated Universal Time (UTC), or neither,
     ///   as indicated by the specified DateTimeKind value.
-    static DateTime SpecifyKind(const DateTime &dateTime, DateTimeKind kind);
+    static constexpr DateTime SpecifyKind(const DateTime &dateTime, DateTimeKind kind);
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Subtracts the specified date and time from this instance.
-    DateTime Subtract(const DateTime &dateTime) const;
+    constexpr TimeSpan Subtract(const DateTime &dateTime) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Subtracts the specified duration from this instance.
-    DateTime Subtract(const TimeSpan &timeSpan) const;
+    constexpr DateTime Subtract(const TimeSpan &timeSpan) const;
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Converts the value of the current DateTime object to local time.
+    ///   The ticks of DateTimeKind::None DateTimes are taken as UTC.
     void ToLocalTime();
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts this instance to a std::chrono::local_time at its wall
+    ///   clock - Only Local DateTimes need the time zone for it.
+    constexpr local_time_t ToLocalTimePoint() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts this instance to a std::chrono::sys_time. The ticks of
+    ///   DateTimeKind::None DateTimes are taken as UTC.
+    constexpr sys_time_t ToSysTime() const;
+
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Converts the value of the current DateTime object to
-    ///   Coordinated Universal Time (UTC).
+    ///   Coordinated Universal Time (UTC). The ticks of DateTimeKind::None
+    ///   DateTimes are taken as UTC - TimeZone::Local().ConvertToUtc takes
+    ///   them as the local wall clock instead.
     void ToUniversalTime();
 
 
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Like Compare only the ticks are compared - The kind is ignored.
+    friend constexpr bool operator < (const DateTime &lhs, const DateTime &rhs);
+    friend constexpr bool operator > (const DateTime &lhs, const DateTime &rhs);
+
+    friend constexpr bool operator <=(const DateTime &lhs, const DateTime &rhs);
+    friend constexpr bool operator >=(const DateTime &lhs, const DateTime &rhs);
+
+    friend constexpr bool operator ==(const DateTime &lhs, const DateTime &rhs);
+    friend constexpr bool operator !=(const DateTime &lhs, const DateTime &rhs);
+
+
     //------------------------------------------------------------------------//
     // Helper Methods                                                         //
     //------------------------------------------------------------------------//
 private:
-    const tm_t& Update_tm()const;
+    //--------------------------------------------------------------------------
+    // The only parts that need the local time zone - Kept out of line so
+    // everything else can be constexpr.
+    static time_t LocalUtcOffsetTicks(time_t utcTicks);
+    static time_t LocalToUtcTicks    (time_t localTicks);
+
+    //--------------------------------------------------------------------------
+    // Start of the unit holding the given ticks and start of the unit
+    // after the one starting at the given ticks.
+    static constexpr time_t UnitFloorTicks(time_t ticks, DateTimeUnit unit);
+    static constexpr time_t UnitNextTicks (time_t ticks, DateTimeUnit unit);
+
+    //--------------------------------------------------------------------------
+    // Applies the rounding to the wall clock ticks - Local DateTimes hold
+    // UTC ticks.
+    template <typename TRounding>
+    constexpr DateTime RoundWallClock(TRounding rounding) const
+    {
+        auto kind  = UnpackKind();
+        auto ticks = UnpackTicks();
+        if(kind != DateTimeKind::Local)
+            return DateTime(rounding(ticks), kind);
+
+        ticks = rounding(ticks + LocalUtcOffsetTicks(ticks));
+        return DateTime(LocalToUtcTicks(ticks), kind);
+    }
+
+    //--------------------------------------------------------------------------
+    // Sums that would leave [MinTicks, MaxTicks] throw, even the ones that
+    // overflow a time_t (the TimeSpans span the whole time_t range).
+    static constexpr time_t CheckedAddTicks(time_t lhs, time_t rhs)
+    {
+        auto sum = time_t(0);
+        if(__builtin_add_overflow(lhs, rhs, &sum))
+            throw std::out_of_range("DateTime - Ticks out of range");
+
+        return sum;
+    }
+
+    static constexpr time_t CheckedSubtractTicks(time_t lhs, time_t rhs)
+    {
+        auto difference = time_t(0);
+        if(__builtin_sub_overflow(lhs, rhs, &difference))
+            throw std::out_of_range("DateTime - Ticks out of range");
+
+        return difference;
+    }
+
+    //--------------------------------------------------------------------------
+    // The double based Add* - The offset is checked while still a double,
+    // since converting a double that doesn't fit a time_t is undefined.
+    // No offset larger than MaxTicks - MinTicks can give a valid DateTime.
+    constexpr DateTime AddScaled(double value, time_t ticksPerUnit) const
+    {
+        auto offset = value * double(ticksPerUnit);
+        if(!(offset >= -double(MaxTicks - MinTicks) && offset <= double(MaxTicks - MinTicks)))
+            throw std::out_of_range("DateTime - Ticks out of range");
 
+        return DateTime(CheckedAddTicks(UnpackTicks(), time_t(offset)), UnpackKind());
+    }
+
+    static constexpr time_t CheckedSizeTicks(const TimeSpan &size)
+    {
+        if(size.Ticks() <= 0)
+            throw std::invalid_argument("DateTime - Rounding size must be positive");
+
+        return size.Ticks();
+    }
+
+    //--------------------------------------------------------------------------
+    // The kind is stored XORed in the 2 topmost bits of the ticks, with UTC
+    // encoded as 0 - So an UTC DateTime has exactly the bits of its ticks.
+    static constexpr std::uint64_t Pack(time_t ticks, DateTimeKind kind)
+    {
+        if(ticks < MinTicks || ticks > MaxTicks)
+            throw std::out_of_range("DateTime - Ticks out of range");
+
+        return std::uint64_t(ticks)
+             ^ (std::uint64_t(int(kind) ^ int(DateTimeKind::UTC)) << 62);
+    }
+
+    constexpr time_t UnpackTicks() const
+    {
+        // Sign extend the lower 62 bits.
+        return time_t(m_ticksAndKind << 2) >> 2;
+    }
+
+    constexpr DateTimeKind UnpackKind() const
+    {
+        return DateTimeKind(
+            int((m_ticksAndKind ^ std::uint64_t(UnpackTicks())) >> 62)
+          ^ int(DateTimeKind::UTC)
+        );
+    }
 
 
     //------------------------------------------------------------------------//
     // iVars                                                                  //
     //------------------------------------------------------------------------//
 private:
-    time_t       m_ticksSinceUnixEpoch;
-    DateTimeKind m_kind;
-
-    mutable tm_t m_tm;
-    mutable bool m_tmIsDirty;
+    std::uint64_t m_ticksAndKind;
 };
 
+//------------------------------------------------------------------------------
+// DateTime is meant to be stored in bulk as a plain 64 bits value.
+static_assert(sizeof(DateTime) == sizeof(std::uint64_t));
+static_assert(std::is_trivially_copyable<DateTime>::value);
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+constexpr DateTime::DateTime(
+    time_t       year,
+    time_t       month,
+    time_t       day,
+    time_t       hour,
+    time_t       minute,
+    time_t       second,
+    time_t       millisecond,
+    DateTimeKind kind /* = DateTimeKind::UTC */) :
+    m_ticksAndKind(0)
+{
+    auto ticks = CivilCalendar::ComposeTicks(
+        year, month, day, hour, minute, second, millisecond
+    );
+
+    //--------------------------------------------------------------------------
+    // Local DateTimes hold UTC ticks.
+    if(kind == DateTimeKind::Local)
+        ticks = LocalToUtcTicks(ticks);
+
+    m_ticksAndKind = Pack(ticks, kind);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime::DateTime(
+    time_t       ticks,
+    DateTimeKind kind /* = DateTimeKind::UTC */) :
+    m_ticksAndKind(Pack(ticks, kind))
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Getters                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Day() const
+{
+    return Fields().day;
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::DayOfWeek() const
+{
+    return Fields().dayOfWeek;
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::DayOfYear() const
+{
+    return Fields().dayOfYear;
+}
+
+//------------------------------------------------------------------------------
+constexpr CivilFields DateTime::Fields() const
+{
+    //--------------------------------------------------------------------------
+    // Local DateTimes hold UTC ticks - Shift them to the local wall clock.
+    // UTC and None DateTimes are already at their wall clock.
+    auto ticks = UnpackTicks();
+    if(UnpackKind() == DateTimeKind::Local)
+        ticks += LocalUtcOffsetTicks(ticks);
+
+    return CivilCalendar::DecomposeTicks(ticks);
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Hour() const
+{
+    return Fields().hour;
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime::DateTimeKind DateTime::Kind() const
+{
+    return UnpackKind();
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Millisecond() const
+{
+    return CivilCalendar::FloorMod(UnpackTicks(), TimeSpan::TicksPerSecond)
+         / TimeSpan::TicksPerMillisecond;
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Minute() const
+{
+    return Fields().minute;
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Month() const
+{
+    return Fields().month;
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Second() const
+{
+    return Fields().second;
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Ticks() const
+{
+    return UnpackTicks();
+}
+
+//------------------------------------------------------------------------------
+constexpr TimeSpan DateTime::TimeOfDay() const
+{
+    auto fields = Fields();
+    return TimeSpan(0, fields.hour, fields.minute, fields.second, fields.millisecond)
+         + TimeSpan(CivilCalendar::FloorMod(UnpackTicks(), TimeSpan::TicksPerMillisecond));
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Year() const
+{
+    return Fields().year;
+}
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::Add(const TimeSpan &timeSpan) const
+{
+    return DateTime(CheckedAddTicks(UnpackTicks(), timeSpan.Ticks()), UnpackKind());
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::AddDays(double days) const
+{
+    return AddScaled(days, TimeSpan::TicksPerDay);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::AddHours(double hours) const
+{
+    return AddScaled(hours, TimeSpan::TicksPerHour);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::AddMilliseconds(double ms) const
+{
+    return AddScaled(ms, TimeSpan::TicksPerMillisecond);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::AddMinutes(double minutes) const
+{
+    return AddScaled(minutes, TimeSpan::TicksPerMinute);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::AddMonths(time_t months) const
+{
+    //--------------------------------------------------------------------------
+    // Work on the wall clock - Local DateTimes hold UTC ticks.
+    auto kind  = UnpackKind();
+    auto ticks = UnpackTicks();
+    if(kind == DateTimeKind::Local)
+        ticks += LocalUtcOffsetTicks(ticks);
+
+    auto days         = CivilCalendar::FloorDiv(ticks, TimeSpan::TicksPerDay);
+    auto ticks_of_day = ticks - days * TimeSpan::TicksPerDay;
+    auto date         = CivilCalendar::CivilFromDays(days);
+
+    //--------------------------------------------------------------------------
+    // Calculate which month/year we gonna be.
+    auto total_months = date.year * 12 + (date.month - 1) + months;
+    auto target_year  = CivilCalendar::FloorDiv(total_months, 12);
+    auto target_month = total_months - target_year * 12 + 1;
+
+    //--------------------------------------------------------------------------
+    // Clamp the day, so it'll be valid on that month.
+    auto days_in_target_month = DaysInMonth(target_month, target_year);
+    auto target_day           = date.day;
+    if(target_day > days_in_target_month)
+        target_day = days_in_target_month;
+
+    ticks = CivilCalendar::DaysFromCivil(target_year, target_month, target_day)
+          * TimeSpan::TicksPerDay
+          + ticks_of_day;
+
+    if(kind == DateTimeKind::Local)
+        ticks = LocalToUtcTicks(ticks);
+
+    return DateTime(ticks, kind);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::AddSeconds(double seconds) const
+{
+    return AddScaled(seconds, TimeSpan::TicksPerSecond);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::AddTicks(time_t ticks) const
+{
+    return DateTime(CheckedAddTicks(UnpackTicks(), ticks), UnpackKind());
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::AddYears(time_t years) const
+{
+    return AddMonths(years * 12);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::Ceil(DateTimeUnit unit) const
+{
+    return RoundWallClock([unit](time_t ticks) {
+        auto floor = UnitFloorTicks(ticks, unit);
+        return (floor == ticks) ? ticks : UnitNextTicks(floor, unit);
+    });
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::Ceil(const TimeSpan &size) const
+{
+    auto size_ticks = CheckedSizeTicks(size);
+    return RoundWallClock([size_ticks](time_t ticks) {
+        auto remainder = CivilCalendar::FloorMod(ticks, size_ticks);
+        return (remainder == 0) ? ticks : CheckedAddTicks(ticks - remainder, size_ticks);
+    });
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::Compare(const DateTime &lhs, const DateTime &rhs)
+{
+    //--------------------------------------------------------------------------
+    // Like .NET the kind is ignored - Only the ticks are compared.
+    auto lhs_ticks = lhs.UnpackTicks();
+    auto rhs_ticks = rhs.UnpackTicks();
+
+    return (lhs_ticks > rhs_ticks) - (lhs_ticks < rhs_ticks);
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::CompareTo(const DateTime &rhs) const
+{
+    return Compare(*this, rhs);
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::DaysInMonth(time_t month, time_t year)
+{
+    if(month < 1 || month > 12)
+        throw std::out_of_range("DateTime - Month out of range");
+
+    return CivilCalendar::DaysInMonth(month, year);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::Floor(DateTimeUnit unit) const
+{
+    return RoundWallClock([unit](time_t ticks) {
+        return UnitFloorTicks(ticks, unit);
+    });
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::Floor(const TimeSpan &size) const
+{
+    auto size_ticks = CheckedSizeTicks(size);
+    return RoundWallClock([size_ticks](time_t ticks) {
+        return ticks - CivilCalendar::FloorMod(ticks, size_ticks);
+    });
+}
+
+//------------------------------------------------------------------------------
+constexpr bool DateTime::IsLeapYear(time_t year)
+{
+    return CivilCalendar::IsLeapYear(year);
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::Round(DateTimeUnit unit) const
+{
+    return RoundWallClock([unit](time_t ticks) {
+        auto floor = UnitFloorTicks(ticks, unit);
+        if(floor == ticks)
+            return ticks;
+
+        auto ceil = UnitNextTicks(floor, unit);
+        return (ticks - floor < ceil - ticks) ? floor : ceil;
+    });
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::Round(const TimeSpan &size) const
+{
+    auto size_ticks = CheckedSizeTicks(size);
+    return RoundWallClock([size_ticks](time_t ticks) {
+        auto remainder = CivilCalendar::FloorMod(ticks, size_ticks);
+        return (remainder < size_ticks - remainder)
+            ? ticks - remainder
+            : CheckedAddTicks(ticks - remainder, size_ticks);
+    });
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::SpecifyKind(const DateTime &dateTime, DateTimeKind kind)
+{
+    return DateTime(dateTime.UnpackTicks(), kind);
+}
+
+//------------------------------------------------------------------------------
+constexpr TimeSpan DateTime::Subtract(const DateTime &dateTime) const
+{
+    return TimeSpan(UnpackTicks() - dateTime.UnpackTicks());
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime DateTime::Subtract(const TimeSpan &timeSpan) const
+{
+    return DateTime(CheckedSubtractTicks(UnpackTicks(), timeSpan.Ticks()), UnpackKind());
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime::local_time_t DateTime::ToLocalTimePoint() const
+{
+    auto ticks = UnpackTicks();
+    if(UnpackKind() == DateTimeKind::Local)
+        ticks += LocalUtcOffsetTicks(ticks);
+
+    return local_time_t(TimeSpan::duration_t(ticks));
+}
+
+//------------------------------------------------------------------------------
+constexpr DateTime::sys_time_t DateTime::ToSysTime() const
+{
+    //--------------------------------------------------------------------------
+    // Local DateTimes already hold UTC ticks.
+    return sys_time_t(TimeSpan::duration_t(UnpackTicks()));
+}
+
+
+//----------------------------------------------------------------------------//
+// Operators                                                                  //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+constexpr bool operator <(const DateTime &lhs, const DateTime &rhs)
+{
+    return lhs.UnpackTicks() < rhs.UnpackTicks();
+}
+
+//------------------------------------------------------------------------------
+constexpr bool operator >(const DateTime &lhs, const DateTime &rhs)
+{
+    return lhs.UnpackTicks() > rhs.UnpackTicks();
+}
+
+//------------------------------------------------------------------------------
+constexpr bool operator <=(const DateTime &lhs, const DateTime &rhs)
+{
+    return lhs.UnpackTicks() <= rhs.UnpackTicks();
+}
+
+//------------------------------------------------------------------------------
+constexpr bool operator >=(const DateTime &lhs, const DateTime &rhs)
+{
+    return lhs.UnpackTicks() >= rhs.UnpackTicks();
+}
+
+//------------------------------------------------------------------------------
+constexpr bool operator ==(const DateTime &lhs, const DateTime &rhs)
+{
+    return lhs.UnpackTicks() == rhs.UnpackTicks();
+}
+
+//------------------------------------------------------------------------------
+constexpr bool operator !=(const DateTime &lhs, const DateTime &rhs)
+{
+    return lhs.UnpackTicks() != rhs.UnpackTicks();
+}
+
+
+//----------------------------------------------------------------------------//
+// Helper Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::UnitFloorTicks(time_t ticks, DateTimeUnit unit)
+{
+    switch(unit)
+    {
+        case DateTimeUnit::Tick:
+            return ticks;
+        case DateTimeUnit::Millisecond:
+            return ticks - CivilCalendar::FloorMod(ticks, TimeSpan::TicksPerMillisecond);
+        case DateTimeUnit::Second:
+            return ticks - CivilCalendar::FloorMod(ticks, TimeSpan::TicksPerSecond);
+        case DateTimeUnit::Minute:
+            return ticks - CivilCalendar::FloorMod(ticks, TimeSpan::TicksPerMinute);
+        case DateTimeUnit::Hour:
+            return ticks - CivilCalendar::FloorMod(ticks, TimeSpan::TicksPerHour);
+        case DateTimeUnit::Day:
+            return ticks - CivilCalendar::FloorMod(ticks, TimeSpan::TicksPerDay);
+
+        //----------------------------------------------------------------------
+        // 1970-01-01 was a Thursday - 3 days after a Monday.
+        case DateTimeUnit::Week:
+            return ticks - CivilCalendar::FloorMod(
+                ticks + 3 * TimeSpan::TicksPerDay,
+                7 * TimeSpan::TicksPerDay
+            );
+
+        default:
+            break;
+    }
+
+    auto date  = CivilCalendar::CivilFromDays(
+        CivilCalendar::FloorDiv(ticks, TimeSpan::TicksPerDay)
+    );
+    auto month = (unit == DateTimeUnit::Month  ) ? date.month
+               : (unit == DateTimeUnit::Quarter) ? date.month - (date.month - 1) % 3
+               : 1;
+
+    return CivilCalendar::DaysFromCivil(date.year, month, 1) * TimeSpan::TicksPerDay;
+}
+
+//------------------------------------------------------------------------------
+constexpr time_t DateTime::UnitNextTicks(time_t ticks, DateTimeUnit unit)
+{
+    switch(unit)
+    {
+        case DateTimeUnit::Tick:        return ticks + 1;
+        case DateTimeUnit::Millisecond: return ticks + TimeSpan::TicksPerMillisecond;
+        case DateTimeUnit::Second:      return ticks + TimeSpan::TicksPerSecond;
+        case DateTimeUnit::Minute:      return ticks + TimeSpan::TicksPerMinute;
+        case DateTimeUnit::Hour:        return ticks + TimeSpan::TicksPerHour;
+        case DateTimeUnit::Day:         return ticks + TimeSpan::TicksPerDay;
+        case DateTimeUnit::Week:        return ticks + 7 * TimeSpan::TicksPerDay;
+        default:                        break;
+    }
+
+    //--------------------------------------------------------------------------
+    // DaysFromCivil carries the months past December to the next year.
+    auto date   = CivilCalendar::CivilFromDays(
+        CivilCalendar::FloorDiv(ticks, TimeSpan::TicksPerDay)
+    );
+    auto months = (unit == DateTimeUnit::Month  ) ?  1
+                : (unit == DateTimeUnit::Quarter) ?  3
+                : 12;
+
+    return CivilCalendar::DaysFromCivil(date.year, date.month + months, 1)
+         * TimeSpan::TicksPerDay;
+}
+
 NS_CORETIME_END
@@ -0,0 +1,157 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+#include <span>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Structure of arrays destination for DateTimeBatch::Decompose.
+///   Each non null column must have room for as many values as the
+///   decomposed ticks. Null columns are not written.
+struct CivilColumns
+{
+    std::int32_t *year        = nullptr;
+    std::int32_t *month       = nullptr; ///< [1-12]
+    std::int32_t *day         = nullptr; ///< [1-31]
+    std::int32_t *hour        = nullptr; ///< [0-23]
+    std::int32_t *minute      = nullptr; ///< [0-59]
+    std::int32_t *second      = nullptr; ///< [0-59]
+    std::int32_t *millisecond = nullptr; ///< [0-999]
+    std::int32_t *dayOfWeek   = nullptr; ///< [0-6] - Sunday is 0.
+    std::int32_t *dayOfYear   = nullptr; ///< [1-366]
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Column oriented operations over arrays of UTC ticks.
+class DateTimeBatch
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    enum class Kernel { Scalar, SSE42, AVX2 };
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the fastest kernel supported by the running CPU.
+    static Kernel BestKernel();
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Breaks each of the given UTC ticks in its calendar fields, writing
+    ///   them in the given columns. The ticks must be in the
+    ///   [DateTime::MinTicks, DateTime::MaxTicks] range.
+    ///   The results are identical to the ones of the DateTime getters.
+    static void Decompose(
+        std::span<const time_t> ticks,
+        const CivilColumns      &columns);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as above but using the given kernel - Kernels that the running
+    ///   CPU doesn't support are replaced by the BestKernel().
+    static void Decompose(
+        std::span<const time_t> ticks,
+        const CivilColumns      &columns,
+        Kernel                  kernel);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes DateTime::Floor / Ceil / Round of each of the given UTC
+    ///   ticks in result, which must have room for as many values (and
+    ///   can be ticks itself). Units up to Week and sizes of at least a
+    ///   millisecond use the SIMD kernels, the calendar units are done
+    ///   one by one.
+    ///   Throws std::invalid_argument if result is too small (or the size
+    ///   isn't positive) and, like the DateTime ones, std::out_of_range
+    ///   if any of the ticks or of the results is outside of
+    ///   [DateTime::MinTicks, DateTime::MaxTicks] - result may be partly
+    ///   written by then.
+    static void Floor(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        DateTime::DateTimeUnit  unit);
+
+    static void Floor(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        const TimeSpan          &size);
+
+    static void Ceil(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        DateTime::DateTimeUnit  unit);
+
+    static void Ceil(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        const TimeSpan          &size);
+
+    static void Round(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        DateTime::DateTimeUnit  unit);
+
+    static void Round(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        const TimeSpan          &size);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as above but using the given kernel - Kernels that the running
+    ///   CPU doesn't support are replaced by the BestKernel().
+    static void Floor(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        DateTime::DateTimeUnit  unit,
+        Kernel                  kernel);
+
+    static void Floor(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        const TimeSpan          &size,
+        Kernel                  kernel);
+
+    static void Ceil(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        DateTime::DateTimeUnit  unit,
+        Kernel                  kernel);
+
+    static void Ceil(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        const TimeSpan          &size,
+        Kernel                  kernel);
+
+    static void Round(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        DateTime::DateTimeUnit  unit,
+        Kernel                  kernel);
+
+    static void Round(
+        std::span<const time_t> ticks,
+        std::span<time_t>       result,
+        const TimeSpan          &size,
+        Kernel                  kernel);
+};
+
+NS_CORETIME_END
@@ -0,0 +1,271 @@
+#pragma once
+
+// std
+#include <charconv>
+#include <cstddef>
+#include <ctime>
+#include <system_error>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "CivilCalendar.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+#include "TimeZone.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Writes DateTimes in fixed layouts into caller supplied buffers, in the
+///   style of std::to_chars. The layout is a template parameter, so each
+///   one compiles into straight digit writes - No locale, no strftime and
+///   no allocation. e.g:
+///     char buffer[DateTimeFormat::MaxSize<DateTimeFormat::Layout::ISO8601, 3>];
+///     auto r = DateTimeFormat::Write<DateTimeFormat::Layout::ISO8601, 3>(
+///         buffer, std::end(buffer), dateTime
+///     );
+///
+///   The buffer is NOT null terminated. On success the result ptr is one
+///   past the last written char and ec is std::errc(). If the buffer is too
+///   small ec is std::errc::value_too_large and the result ptr is last.
+///   If the year doesn't fit in 4 digits ec is std::errc::result_out_of_range.
+class DateTimeFormat
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    enum class Layout
+    {
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   yyyy-MM-ddTHH:mm:ss[.fffffff][Z|+HH:mm[:ss]|-HH:mm[:ss]]
+        ///   The fraction has FractionDigits digits (0 to 7, truncated).
+        ///   UTC DateTimes end with Z, Local ones with the offset of the
+        ///   local zone and DateTimeKind::None ones with nothing. The
+        ///   seconds of the offset are only written when they aren't zero
+        ///   (e.g. the -03:06:28 of the Sao Paulo LMT).
+        ISO8601,
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   ddd, dd MMM yyyy HH:mm:ss GMT
+        ///   Always written in UTC - DateTimeKind::None is taken as UTC.
+        RFC1123,
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   yyyyMMddHHmmss
+        Compact
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The largest number of chars written by the given layout.
+    template <Layout TLayout, int TFractionDigits = 0>
+    static constexpr size_t MaxSize =
+          (TLayout == Layout::ISO8601) ? 19 + (TFractionDigits ? TFractionDigits + 1 : 0) + 9
+        : (TLayout == Layout::RFC1123) ? 29
+        : 14;
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes the given DateTime into [first, last) with the given layout.
+    template <Layout TLayout, int TFractionDigits = 0>
+    static std::to_chars_result Write(
+        char           *first,
+        char           *last,
+        const DateTime &dateTime)
+    {
+        static_assert(
+            TFractionDigits >= 0 && TFractionDigits <= 7,
+            "DateTimeFormat - FractionDigits must be in [0, 7]"
+        );
+        static_assert(
+            TLayout == Layout::ISO8601 || TFractionDigits == 0,
+            "DateTimeFormat - Only ISO8601 has fractional seconds"
+        );
+
+        if constexpr(TLayout == Layout::ISO8601)
+            return WriteISO8601<TFractionDigits>(first, last, dateTime);
+        else if constexpr(TLayout == Layout::RFC1123)
+            return WriteRFC1123(first, last, dateTime);
+        else
+            return WriteCompact(first, last, dateTime);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    static void Write2(char *p, time_t value)
+    {
+        p[0] = char('0' + value / 10);
+        p[1] = char('0' + value % 10);
+    }
+
+    static void Write4(char *p, time_t value)
+    {
+        Write2(p + 0, value / 100);
+        Write2(p + 2, value % 100);
+    }
+
+    static bool YearFits(time_t year)
+    {
+        return year >= 0 && year <= 9999;
+    }
+
+    //--------------------------------------------------------------------------
+    template <int TFractionDigits>
+    static std::to_chars_result WriteISO8601(
+        char           *first,
+        char           *last,
+        const DateTime &dateTime)
+    {
+        auto kind  = dateTime.Kind();
+        auto ticks = dateTime.Ticks();
+
+        //----------------------------------------------------------------------
+        // Local DateTimes are written in the local wall clock with its
+        // offset - Computed once and shared with the fields.
+        auto offset = time_t(0);
+        if(kind == DateTime::DateTimeKind::Local)
+            offset = TimeZone::Local().UtcOffsetTicks(ticks);
+
+        auto offset_seconds = offset / TimeSpan::TicksPerSecond;
+        auto offset_size    = (offset_seconds % 60 != 0) ? 9 : 6;
+
+        auto size = size_t(19)
+                  + (TFractionDigits ? TFractionDigits + 1 : 0)
+                  + ((kind == DateTime::DateTimeKind::UTC  ) ? 1
+                   : (kind == DateTime::DateTimeKind::Local) ? offset_size
+                   : 0);
+
+        if(size_t(last - first) < size)
+            return { last, std::errc::value_too_large };
+
+        auto fields = CivilCalendar::DecomposeTicks(ticks + offset);
+        if(!YearFits(fields.year))
+            return { first, std::errc::result_out_of_range };
+
+        auto p = first;
+        Write4(p +  0, fields.year);   p[ 4] = '-';
+        Write2(p +  5, fields.month);  p[ 7] = '-';
+        Write2(p +  8, fields.day);    p[10] = 'T';
+        Write2(p + 11, fields.hour);   p[13] = ':';
+        Write2(p + 14, fields.minute); p[16] = ':';
+        Write2(p + 17, fields.second);
+        p += 19;
+
+        if constexpr(TFractionDigits > 0)
+        {
+            //------------------------------------------------------------------
+            // Zone offsets are whole seconds, so the fraction is the
+            // same for the UTC and the local ticks.
+            auto fraction = CivilCalendar::FloorMod(ticks, TimeSpan::TicksPerSecond);
+            for(auto i = TFractionDigits; i < 7; ++i)
+                fraction /= 10;
+
+            *p = '.';
+            for(auto i = TFractionDigits; i > 0; --i)
+            {
+                p[i]      = char('0' + fraction % 10);
+                fraction /= 10;
+            }
+            p += TFractionDigits + 1;
+        }
+
+        if(kind == DateTime::DateTimeKind::UTC)
+        {
+            *p++ = 'Z';
+        }
+        else if(kind == DateTime::DateTimeKind::Local)
+        {
+            p[0] = (offset_seconds < 0) ? '-' : '+';
+            if(offset_seconds < 0)
+                offset_seconds = -offset_seconds;
+
+            Write2(p + 1, offset_seconds / 3600);      p[3] = ':';
+            Write2(p + 4, offset_seconds / 60 % 60);
+            if(offset_size == 9)
+            {
+                p[6] = ':';
+                Write2(p + 7, offset_seconds % 60);
+            }
+            p += offset_size;
+        }
+
+        return { p, std::errc() };
+    }
+
+    //--------------------------------------------------------------------------
+    static std::to_chars_result WriteRFC1123(
+        char           *first,
+        char           *last,
+        const DateTime &dateTime)
+    {
+        constexpr char k_days  [] = "SunMonTueWedThuFriSat";
+        constexpr char k_months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+
+        if(size_t(last - first) < 29)
+            return { last, std::errc::value_too_large };
+
+        //----------------------------------------------------------------------
+        // Local DateTimes already hold the UTC ticks.
+        auto fields = CivilCalendar::DecomposeTicks(dateTime.Ticks());
+        if(!YearFits(fields.year))
+            return { first, std::errc::result_out_of_range };
+
+        auto day   = k_days   + fields.dayOfWeek   * 3;
+        auto month = k_months + (fields.month - 1) * 3;
+
+        auto p = first;
+        p[ 0] = day[0]; p[1] = day[1]; p[2] = day[2];
+        p[ 3] = ',';
+        p[ 4] = ' ';
+        Write2(p + 5, fields.day);
+        p[ 7] = ' ';
+        p[ 8] = month[0]; p[9] = month[1]; p[10] = month[2];
+        p[11] = ' ';
+        Write4(p + 12, fields.year);   p[16] = ' ';
+        Write2(p + 17, fields.hour);   p[19] = ':';
+        Write2(p + 20, fields.minute); p[22] = ':';
+        Write2(p + 23, fields.second);
+        p[25] = ' ';
+        p[26] = 'G'; p[27] = 'M'; p[28] = 'T';
+
+        return { p + 29, std::errc() };
+    }
+
+    //--------------------------------------------------------------------------
+    static std::to_chars_result WriteCompact(
+        char           *first,
+        char           *last,
+        const DateTime &dateTime)
+    {
+        if(size_t(last - first) < 14)
+            return { last, std::errc::value_too_large };
+
+        auto fields = dateTime.Fields();
+        if(!YearFits(fields.year))
+            return { first, std::errc::result_out_of_range };
+
+        Write4(first +  0, fields.year);
+        Write2(first +  4, fields.month);
+        Write2(first +  6, fields.day);
+        Write2(first +  8, fields.hour);
+        Write2(first + 10, fields.minute);
+        Write2(first + 12, fields.second);
+
+        return { first + 14, std::errc() };
+    }
+};
+
+NS_CORETIME_END
@@ -0,0 +1,175 @@
+#pragma once
+
+// std
+#include <compare>
+#include <cstddef>
+#include <ctime>
+#include <iterator>
+#include <ranges>
+#include <span>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A lazy random access view of the DateTimes from first (inclusive) to
+///   last (exclusive) going by a fixed step or a number of calendar units,
+///   e.g:
+///     auto axis = DateTimeRange(start, end, TimeSpan(0, 5, 0));
+///     for(const auto &dateTime : axis)
+///         ...
+///
+///   Every value is computed from first and its index - Never from the
+///   previous one - So calendar steps don't drift: Monthly values from a
+///   Jan 31 are Feb 29, Mar 31, Apr 30... (as first.AddMonths(i)).
+///   Fixed steps are a multiply-add on the ticks and calendar steps a
+///   single AddMonths, so size() and operator[] are O(1) for both.
+///
+///   Negative steps go backwards, down to (but not including) last.
+class DateTimeRange :
+    public std::ranges::view_interface<DateTimeRange>
+{
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    class Iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag iterator_concept;
+        typedef std::input_iterator_tag         iterator_category;
+        typedef DateTime                        value_type;
+        typedef std::ptrdiff_t                  difference_type;
+
+    public:
+        Iterator() = default;
+
+        Iterator(const DateTimeRange *range, difference_type index) :
+            m_range(range),
+            m_index(index)
+        {
+            // Empty...
+        }
+
+    public:
+        DateTime operator *() const { return (*m_range)[size_t(m_index)]; }
+        DateTime operator [](difference_type n) const { return *(*this + n); }
+
+        Iterator& operator ++() { ++m_index; return *this; }
+        Iterator& operator --() { --m_index; return *this; }
+        Iterator  operator ++(int) { auto it = *this; ++m_index; return it; }
+        Iterator  operator --(int) { auto it = *this; --m_index; return it; }
+
+        Iterator& operator +=(difference_type n) { m_index += n; return *this; }
+        Iterator& operator -=(difference_type n) { m_index -= n; return *this; }
+
+        friend Iterator operator +(Iterator it, difference_type n) { return it += n; }
+        friend Iterator operator +(difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator -(Iterator it, difference_type n) { return it -= n; }
+
+        friend difference_type operator -(const Iterator &lhs, const Iterator &rhs)
+        {
+            return lhs.m_index - rhs.m_index;
+        }
+
+        bool operator ==(const Iterator &rhs) const { return m_index == rhs.m_index; }
+        auto operator<=>(const Iterator &rhs) const { return m_index <=> rhs.m_index; }
+
+    private:
+        const DateTimeRange *m_range = nullptr;
+        difference_type     m_index  = 0;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new range from first to last by the given step.
+    ///   Throws std::invalid_argument if the step is zero.
+    DateTimeRange(
+        const DateTime &first,
+        const DateTime &last,
+        const TimeSpan &step);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new range from first to last by the given number of
+    ///   units. Units up to Week are fixed steps, Month, Quarter and Year
+    ///   step on the calendar (the wall clock for Local DateTimes).
+    ///   Throws std::invalid_argument if the count is zero.
+    DateTimeRange(
+        const DateTime         &first,
+        const DateTime         &last,
+        DateTime::DateTimeUnit unit,
+        time_t                 count = 1);
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of values of the range.
+    size_t size() const { return m_count; }
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end  () const { return Iterator(this, std::ptrdiff_t(m_count)); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the value at the given index - Not bounds checked.
+    DateTime operator [](size_t index) const
+    {
+        if(m_stepMonths != 0)
+            return m_first.AddMonths(time_t(index) * m_stepMonths);
+
+        return m_first.AddTicks(time_t(index) * m_stepTicks);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the value at the given index.
+    ///   Throws std::out_of_range if index isn't less than size().
+    DateTime At(size_t index) const;
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes the ticks of ticks.size() values starting at the given index
+    ///   into ticks. Fixed steps are an arithmetic sequence filled in bulk
+    ///   (which vectorizes), calendar steps are one AddMonths per value.
+    ///   Throws std::out_of_range if they go past size().
+    void FillTicks(size_t first, std::span<time_t> ticks) const;
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    size_t CountMonthSteps(const DateTime &last) const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    DateTime m_first;
+    time_t   m_stepTicks;       // Zero on calendar steps.
+    time_t   m_stepMonths;      // Zero on fixed steps.
+    size_t   m_count;
+};
+
+NS_CORETIME_END
@@ -0,0 +1,67 @@
+#pragma once
+
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "CivilCalendar.h"
+#include "DateTime.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A DateTime together with its calendar fields, computed once at
+///   construction. Use it when several fields of the same DateTime are
+///   needed - The DateTime itself doesn't keep any cache, so each of its
+///   field getters decomposes the ticks again.
+class DecomposedDateTime
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new instance with the fields of the given DateTime.
+    explicit DecomposedDateTime(const DateTime &dateTime) :
+        m_dateTime(dateTime),
+        m_fields  (dateTime.Fields())
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the DateTime that this instance was built from.
+    const DateTime& GetDateTime() const { return m_dateTime; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets all the calendar fields of this instance.
+    const CivilFields& Fields() const { return m_fields; }
+
+    time_t Year       () const { return m_fields.year;        }
+    time_t Month      () const { return m_fields.month;       }
+    time_t Day        () const { return m_fields.day;         }
+    time_t Hour       () const { return m_fields.hour;        }
+    time_t Minute     () const { return m_fields.minute;      }
+    time_t Second     () const { return m_fields.second;      }
+    time_t Millisecond() const { return m_fields.millisecond; }
+    time_t DayOfWeek  () const { return m_fields.dayOfWeek;   }
+    time_t DayOfYear  () const { return m_fields.dayOfYear;   }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    DateTime    m_dateTime;
+    CivilFields m_fields;
+};
+
+NS_CORETIME_END
@@ -0,0 +1,234 @@
+#pragma once
+
+// std
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <vector>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A log-linear (HDR style) histogram of TimeSpans for latency
+///   measurements.
+///
+///   Each power of two range of ticks is split in 2^significantBits equal
+///   buckets, so every recorded value is kept with a relative error of at
+///   most 1 / 2^significantBits. Values above the highest trackable one
+///   are counted in the last bucket and negative ones as zero.
+///
+///   The buckets are replicated in shards and each thread records in its
+///   own shard with relaxed atomic increments - Record() is wait-free and
+///   threads only contend when there are more of them than shards. The
+///   footprint is 8 bytes per bucket per shard, e.g. one hour at 7 bits
+///   (< 0.8% error) is ~3800 buckets, ~30KB per shard.
+class LatencyHistogram
+{
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   A plain (non atomic) copy of the counts of a LatencyHistogram.
+    ///   Snapshots of histograms with the same significant bits can be
+    ///   merged, even if their ranges differ.
+    class Snapshot
+    {
+        friend class LatencyHistogram;
+
+        //--------------------------------------------------------------------//
+        // CTOR / DTOR                                                        //
+        //--------------------------------------------------------------------//
+    public:
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Initializes an empty snapshot.
+        explicit Snapshot(int significantBits);
+
+
+        //--------------------------------------------------------------------//
+        // Getters                                                            //
+        //--------------------------------------------------------------------//
+    public:
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Gets the number of recorded values.
+        std::uint64_t Count() const { return m_count; }
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Gets the smallest recorded value - Rounded down to the
+        ///   precision of the histogram.
+        TimeSpan Min() const;
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Gets the largest recorded value - Rounded up to the
+        ///   precision of the histogram.
+        TimeSpan Max() const;
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Gets the mean of the recorded values - It is exact, computed
+        ///   from the sum of the values and not from the buckets.
+        TimeSpan Mean() const;
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Gets the value at the given percentile [0-100] - Rounded up
+        ///   to the precision of the histogram.
+        TimeSpan Percentile(double percentile) const;
+
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Gets the significant bits of the histogram.
+        int SignificantBits() const { return m_significantBits; }
+
+
+        //--------------------------------------------------------------------//
+        // Methods                                                            //
+        //--------------------------------------------------------------------//
+    public:
+        ///---------------------------------------------------------------------
+        /// @brief
+        ///   Adds the counts of the given snapshot to this one.
+        ///   Throws std::invalid_argument if their significant bits differ.
+        void Merge(const Snapshot &other);
+
+
+        //--------------------------------------------------------------------//
+        // iVars                                                              //
+        //--------------------------------------------------------------------//
+    private:
+        int                        m_significantBits;
+        std::vector<std::uint64_t> m_buckets;
+        std::uint64_t              m_count;
+        std::uint64_t              m_sumTicks;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new histogram that tracks values from zero to
+    ///   highestTrackable with 2^significantBits buckets per power of two.
+    ///   A shardCount of 0 means one shard per hardware thread.
+    ///   Throws std::invalid_argument if highestTrackable isn't positive
+    ///   or significantBits isn't in [1, 16].
+    LatencyHistogram(
+        const TimeSpan &highestTrackable,
+        int            significantBits = 7,
+        size_t         shardCount      = 0);
+
+    LatencyHistogram(const LatencyHistogram &) = delete;
+    LatencyHistogram& operator =(const LatencyHistogram &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of buckets of each shard.
+    size_t BucketCount() const { return m_bucketCount; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of shards.
+    size_t ShardCount() const { return m_shards.size(); }
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Records the given value in the shard of the calling thread.
+    ///   Wait-free - Safe to call from any number of threads.
+    void Record(const TimeSpan &value)
+    {
+        auto ticks = (value.Ticks() > 0) ? std::uint64_t(value.Ticks()) : 0;
+        auto &shard = m_shards[ThreadIndex() % m_shards.size()];
+
+        shard.buckets[BucketIndex(ticks)].fetch_add(1, std::memory_order_relaxed);
+        shard.sumTicks.fetch_add(ticks, std::memory_order_relaxed);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets a copy of the counts of all the shards. Values recorded
+    ///   concurrently may or may not be part of it.
+    Snapshot GetSnapshot() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Clears all the counts. Values recorded concurrently may or may
+    ///   not be cleared.
+    void Reset();
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    size_t BucketIndex(std::uint64_t ticks) const
+    {
+        if(ticks > m_highestTicks)
+            ticks = m_highestTicks;
+
+        //----------------------------------------------------------------------
+        // The first 2^(bits + 1) buckets are one tick wide, each power of
+        // two after them has 2^bits buckets.
+        auto msb = 63 - __builtin_clzll(ticks | 1);
+        if(msb < m_significantBits)
+            return size_t(ticks);
+
+        auto shift = msb - m_significantBits;
+        return (size_t(shift + 1) << m_significantBits)
+             + size_t(ticks >> shift)
+             - (size_t(1) << m_significantBits);
+    }
+
+    //--------------------------------------------------------------------------
+    // Threads get consecutive indexes on their first record, so the first
+    // ShardCount() threads never share a shard.
+    static size_t ThreadIndex()
+    {
+        static std::atomic<size_t> s_nextIndex(0);
+        thread_local size_t        t_index = s_nextIndex.fetch_add(1, std::memory_order_relaxed);
+
+        return t_index;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    //--------------------------------------------------------------------------
+    // Aligned so the sums of different shards don't share cache lines.
+    struct alignas(64) Shard
+    {
+        std::unique_ptr<std::atomic<std::uint64_t>[]> buckets;
+        std::atomic<std::uint64_t>                    sumTicks;
+    };
+
+    int                m_significantBits;
+    std::uint64_t      m_highestTicks;
+    size_t             m_bucketCount;
+    std::vector<Shard> m_shards;
+};
+
+NS_CORETIME_END
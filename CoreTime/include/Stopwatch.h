@@ -0,0 +1,236 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "ClockSource.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The monotonic clocks that a Stopwatch can read from. Each clock is a
+///   policy type with a static WarmUp() that the Stopwatch calls when it is
+///   constructed, a static Timestamp() that returns a raw counter and a
+///   static ToTicks() that converts a difference of counters to ticks.
+///   The conversion is only done when an elapsed time is read, so
+///   starting and stopping only read the counter.
+class StopwatchClock
+{
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   clock_gettime(CLOCK_MONOTONIC) - Never jumps, even when the wall
+    ///   clock is adjusted. This is the default clock.
+    struct Monotonic
+    {
+        static void WarmUp() { /* Empty... */ }
+
+        // Nanoseconds - The division to ticks is left to ToTicks.
+        static std::uint64_t Timestamp()
+        {
+            struct timespec _timespec = {0, 0};
+            clock_gettime(CLOCK_MONOTONIC, &_timespec);
+
+            return std::uint64_t(_timespec.tv_sec) * 1000000000
+                 + std::uint64_t(_timespec.tv_nsec);
+        }
+
+        static time_t ToTicks(std::uint64_t delta) { return time_t(delta / 100); }
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The CPU time stamp counter, rescaled with the calibration of
+    ///   ClockSource::Tsc - The cheapest clock to read. Falls back to
+    ///   Monotonic when the CPU lacks an invariant TSC.
+    ///   WarmUp() pays the ~10ms calibration, so Timestamp() is left with
+    ///   a single load and the counter read.
+    struct Tsc
+    {
+        static void WarmUp() { ClockSource::Tsc::WarmUp(); }
+
+        static std::uint64_t Timestamp()
+        {
+            if(!ClockSource::Tsc::IsCalibrated())
+                return Monotonic::Timestamp();
+
+            return ClockSource::Tsc::ReadCounter();
+        }
+
+        static time_t ToTicks(std::uint64_t delta)
+        {
+            if(!ClockSource::Tsc::IsCalibrated())
+                return Monotonic::ToTicks(delta);
+
+            auto multiplier = ClockSource::Tsc::GetCalibration().multiplier;
+            return time_t(ClockSource::Tsc::MultiplyShift32(delta, multiplier));
+        }
+    };
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Measures elapsed time on a monotonic clock, e.g:
+///     auto stopwatch = Stopwatch<>::StartNew();
+///     Parse();
+///     auto parse_time = stopwatch.Lap();
+///     Store();
+///     auto store_time = stopwatch.Lap();
+///     auto total_time = stopwatch.Elapsed();
+///
+///   A Stopwatch is not thread safe - Use one per thread.
+template <typename TClock = StopwatchClock::Monotonic>
+class Stopwatch
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new stopped instance with no elapsed time - The
+    ///   clock is warmed up here so Start() and Stop() only read it.
+    Stopwatch() :
+        m_isRunning     (false),
+        m_startTimestamp(0),
+        m_elapsed       (0),
+        m_lapElapsed    (0)
+    {
+        TClock::WarmUp();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new instance and starts measuring elapsed time.
+    static Stopwatch StartNew()
+    {
+        auto stopwatch = Stopwatch();
+        stopwatch.Start();
+
+        return stopwatch;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the total elapsed time measured by this instance.
+    TimeSpan Elapsed() const { return TimeSpan(ElapsedTicks()); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the total elapsed time measured by this instance, in ticks.
+    time_t ElapsedTicks() const { return TClock::ToTicks(ElapsedRaw()); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the total elapsed time measured by this instance, in
+    ///   whole milliseconds.
+    time_t ElapsedMilliseconds() const
+    {
+        return ElapsedTicks() / TimeSpan::TicksPerMillisecond;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets a value indicating whether the Stopwatch timer is running.
+    bool IsRunning() const { return m_isRunning; }
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Starts, or resumes, measuring elapsed time.
+    void Start()
+    {
+        if(m_isRunning)
+            return;
+
+        m_startTimestamp = TClock::Timestamp();
+        m_isRunning      = true;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Stops measuring elapsed time - Elapsed() keeps its value.
+    void Stop()
+    {
+        if(!m_isRunning)
+            return;
+
+        m_elapsed  += TClock::Timestamp() - m_startTimestamp;
+        m_isRunning = false;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Stops measuring and resets the elapsed time (and laps) to zero.
+    void Reset()
+    {
+        m_isRunning  = false;
+        m_elapsed    = 0;
+        m_lapElapsed = 0;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Resets the elapsed time (and laps) to zero and starts measuring.
+    void Restart()
+    {
+        m_elapsed        = 0;
+        m_lapElapsed     = 0;
+        m_startTimestamp = TClock::Timestamp();
+        m_isRunning      = true;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the elapsed time since the previous Lap() (or since the
+    ///   first start) and begins a new lap. Doesn't stop the Stopwatch -
+    ///   It costs a single clock read.
+    TimeSpan Lap()
+    {
+        auto elapsed = ElapsedRaw();
+        auto lap     = elapsed - m_lapElapsed;
+
+        m_lapElapsed = elapsed;
+        return TimeSpan(TClock::ToTicks(lap));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    std::uint64_t ElapsedRaw() const
+    {
+        if(!m_isRunning)
+            return m_elapsed;
+
+        return m_elapsed + (TClock::Timestamp() - m_startTimestamp);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    bool          m_isRunning;
+    std::uint64_t m_startTimestamp; // Raw clock counter.
+    std::uint64_t m_elapsed;        // Raw clock counts - Of the past runs.
+    std::uint64_t m_lapElapsed;     // Raw clock counts - At the last Lap().
+};
+
+NS_CORETIME_END
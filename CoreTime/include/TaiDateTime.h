@@ -0,0 +1,136 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   An instant on the International Atomic Time (TAI) scale - The ticks
+///   count SI seconds since 1970-01-01 00:00:00 TAI, leap seconds
+///   included. DateTime ticks count POSIX seconds (every day has 86400 of
+///   them), so the difference between two DateTimes is off by the leap
+///   seconds between them - The difference between two TaiDateTimes isn't:
+///     auto elapsed = TaiDateTime::Elapsed(start, end);
+///
+///   The conversions use the built-in table of leap seconds, up to the one
+///   of 2016-12-31 (TAI - UTC = 37s), the last announced when this was
+///   written. Before 1972 TAI - UTC is taken as 10s - The rubber seconds
+///   of 1961-1971 are not modeled.
+///
+///   Each thread remembers the table entry of its last conversion, so a
+///   conversion close to the previous one (which is always the case for
+///   current times) costs a single range check.
+class TaiDateTime
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new instance to the given number of TAI ticks.
+    explicit constexpr TaiDateTime(time_t ticks) :
+        m_ticks(ticks)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of TAI ticks of this instance.
+    constexpr time_t Ticks() const { return m_ticks; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets whether this instance is inside a leap second - UTC 23:59:60.
+    bool IsLeapSecond() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the current TAI time.
+    static TaiDateTime Now() { return FromUtc(DateTime::UtcNow()); }
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns a new TaiDateTime that adds the given TimeSpan (in SI
+    ///   seconds) to this instance.
+    constexpr TaiDateTime Add(const TimeSpan &timeSpan) const
+    {
+        return TaiDateTime(m_ticks + timeSpan.Ticks());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the SI time from the given instance to this one.
+    constexpr TimeSpan Subtract(const TaiDateTime &taiDateTime) const
+    {
+        return TimeSpan(m_ticks - taiDateTime.m_ticks);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the SI time between the given DateTimes - Their difference
+    ///   plus the leap seconds inserted between them.
+    static TimeSpan Elapsed(const DateTime &from, const DateTime &to)
+    {
+        return FromUtc(to).Subtract(FromUtc(from));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts the given DateTime to TAI. Local DateTimes hold UTC ticks
+    ///   and the ones of DateTimeKind::None are taken as UTC.
+    static TaiDateTime FromUtc(const DateTime &dateTime)
+    {
+        auto ticks = dateTime.Ticks();
+        return TaiDateTime(ticks + UtcToTaiOffsetTicks(ticks));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts this instance to an UTC DateTime. UTC can't represent the
+    ///   leap seconds themselves - They are given as a repeat of 23:59:59.
+    DateTime ToUtc() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets TAI - UTC in seconds at the given DateTime.
+    static time_t TaiMinusUtcSeconds(const DateTime &dateTime)
+    {
+        return UtcToTaiOffsetTicks(dateTime.Ticks()) / TimeSpan::TicksPerSecond;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    static time_t UtcToTaiOffsetTicks(time_t utcTicks);
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    time_t m_ticks;
+};
+
+NS_CORETIME_END
@@ -0,0 +1,216 @@
+#pragma once
+
+// std
+#include <bit>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A binary column of DateTime or TimeSpan values meant to be memory
+///   mapped and used in place.
+///
+///   Layout (everything little endian):
+///     offset size
+///          0    8  magic       "CTCOLUMN"
+///          8    2  version     1
+///         10    1  valueType   1 DateTime, 2 TimeSpan
+///         11    1  kind        DateTimeKind of all the values (Local 0,
+///                                UTC 1, None 2) or 0xFF if they differ.
+///                                0 on TimeSpan columns.
+///         12    4  reserved    0
+///         16    8  epochTicks  Ticks since the Unix Epoch of value 0.
+///         24    8  tickUnit    Ticks per unit of the values.
+///         32    8  count       Number of values.
+///         40   24  reserved    0
+///         64  8*n  values
+///
+///   DateTime values are the 64 bits word of the DateTime itself - The
+///   ticks in the lower 62 bits (two's complement) and the kind XORed in
+///   the top 2 bits, so UTC values are the plain ticks. TimeSpan values
+///   are their ticks. The values start at offset 64, so a mapped file
+///   (page aligned) has them 8 bytes aligned.
+///
+///   TimeColumnWriter always writes epochTicks 0 and tickUnit 1, which
+///   is what the typed views of TimeColumnReader need. Files with other
+///   units can still be read through TimeColumnReader::RawValues.
+class TimeColumn
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    enum class ValueType : std::uint8_t { DateTime = 1, TimeSpan = 2 };
+
+    static constexpr std::uint16_t Version    = 1;
+    static constexpr std::uint8_t  MixedKinds = 0xFF;
+
+    struct Header
+    {
+        char          magic[8];
+        std::uint16_t version;
+        ValueType     valueType;
+        std::uint8_t  kind;
+        std::uint32_t reserved0;
+        std::int64_t  epochTicks;
+        std::int64_t  tickUnit;
+        std::uint64_t count;
+        std::uint8_t  reserved1[24];
+    };
+
+    static_assert(sizeof(Header) == 64);
+    static_assert(
+        std::endian::native == std::endian::little,
+        "TimeColumn - The values are used in place, so only little endian "
+        "hosts are supported"
+    );
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Writes a TimeColumn file, streaming the values as they are appended.
+///   The count in the header is only written by Close (or the destructor),
+///   until then the file has count 0.
+class TimeColumnWriter
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Creates (or truncates) the file at the given path for a column of
+    ///   the given type. Throws std::runtime_error if it can't be opened.
+    TimeColumnWriter(const std::string &path, TimeColumn::ValueType valueType);
+
+    TimeColumnWriter(const TimeColumnWriter &) = delete;
+    TimeColumnWriter& operator =(const TimeColumnWriter &) = delete;
+
+    ~TimeColumnWriter();
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of appended values.
+    std::uint64_t Count() const { return m_header.count; }
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Appends values to a DateTime column.
+    ///   Throws std::invalid_argument on TimeSpan columns.
+    void Append(const DateTime &dateTime) { Append(std::span<const DateTime>(&dateTime, 1)); }
+    void Append(std::span<const DateTime> dateTimes);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Appends values to a TimeSpan column.
+    ///   Throws std::invalid_argument on DateTime columns.
+    void Append(const TimeSpan &timeSpan) { Append(std::span<const TimeSpan>(&timeSpan, 1)); }
+    void Append(std::span<const TimeSpan> timeSpans);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes the final header and closes the file.
+    ///   Throws std::runtime_error if the file couldn't be written.
+    void Close();
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::ofstream      m_stream;
+    TimeColumn::Header m_header;
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Memory maps a TimeColumn file (read only) and exposes its values in
+///   place - Nothing is copied or converted.
+class TimeColumnReader
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Maps the file at the given path. Throws std::runtime_error if it
+    ///   can't be mapped or isn't a valid TimeColumn file.
+    explicit TimeColumnReader(const std::string &path);
+
+    TimeColumnReader(const TimeColumnReader &) = delete;
+    TimeColumnReader& operator =(const TimeColumnReader &) = delete;
+
+    ~TimeColumnReader();
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the header of the file.
+    const TimeColumn::Header& GetHeader() const { return *m_header; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of values.
+    size_t Count() const { return size_t(m_header->count); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the values as stored, in tickUnit units since epochTicks.
+    std::span<const std::int64_t> RawValues() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the values of a DateTime column. Throws std::logic_error on
+    ///   other columns or if the epoch and unit aren't 0 and 1 ticks.
+    std::span<const DateTime> DateTimes() const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the values of a TimeSpan column. Throws std::logic_error on
+    ///   other columns or if the epoch and unit aren't 0 and 1 ticks.
+    std::span<const TimeSpan> TimeSpans() const;
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    const void* Values(TimeColumn::ValueType valueType) const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    void                     *m_mapping;
+    size_t                   m_mappingSize;
+    const TimeColumn::Header *m_header;
+};
+
+NS_CORETIME_END
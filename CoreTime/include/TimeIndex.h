@@ -0,0 +1,133 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+#include <span>
+#include <utility>
+#include <vector>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A read only search index over a sorted array of ticks, e.g:
+///     auto index = TimeIndex(ticks);
+///     auto [first, last] = index.Range(from, to);
+///     // ticks[first, last) are the ones in [from, to).
+///
+///   The index doesn't copy the ticks - They must outlive it unchanged.
+///
+///   Model::Eytzinger keeps every 16th value in Eytzinger (BFS) order, so
+///   the top levels of the search share a few cache lines and the next
+///   ones are prefetched while comparing - The search is branchless down
+///   to a block of 16 values of the array, which is scanned linearly.
+///
+///   Model::PiecewiseLinear splits the range of the values in equal width
+///   buckets and interpolates the position inside the bucket, searching
+///   only around it by the largest error seen on the bucket. It is O(1)
+///   for evenly spread values (e.g. sampled at a fixed rate) and degrades
+///   to a binary search inside a bucket for bursty ones.
+class TimeIndex
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    enum class Model { Eytzinger, PiecewiseLinear };
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Number of values per sample of Model::Eytzinger and (on average)
+    ///   per bucket of Model::PiecewiseLinear.
+    static constexpr size_t BlockSize = 16;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Builds the index of the given ticks with the given model.
+    ///   Throws std::invalid_argument if the ticks aren't sorted.
+    explicit TimeIndex(std::span<const time_t> ticks, Model model = Model::Eytzinger);
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of indexed values.
+    size_t Count() const { return m_ticks.size(); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the model of the index.
+    Model GetModel() const { return m_model; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the memory used by the index (not counting the ticks).
+    size_t ByteSize() const;
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the index of the first value not less than the given ticks
+    ///   - Count() if there is none. Same as std::lower_bound.
+    size_t LowerBound(time_t ticks) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as above with the ticks of the given DateTime.
+    size_t LowerBound(const DateTime &dateTime) const { return LowerBound(dateTime.Ticks()); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Returns the [first, last) indexes of the values in [from, to).
+    std::pair<size_t, size_t> Range(const DateTime &from, const DateTime &to) const;
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    void BuildEytzinger();
+    void BuildPiecewiseLinear();
+
+    size_t EytzingerLowerBound      (time_t ticks) const;
+    size_t PiecewiseLinearLowerBound(time_t ticks) const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::span<const time_t> m_ticks;
+    Model                   m_model;
+
+    // Model::Eytzinger - 1 based, with the block of each sample.
+    std::vector<time_t> m_samples;
+    std::vector<size_t> m_sampleBlocks;
+
+    // Model::PiecewiseLinear - Bucket b covers the ticks from
+    // m_ticks.front() + b * m_bucketWidth and its values start at
+    // m_bucketStarts[b].
+    std::uint64_t              m_bucketWidth;
+    double                     m_bucketScale;    // 1 / m_bucketWidth.
+    std::vector<size_t>        m_bucketStarts;
+    std::vector<std::uint32_t> m_bucketErrors;
+};
+
+NS_CORETIME_END
@@ -0,0 +1,407 @@
+#pragma once
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Sorts DateTimes and TimeSpans by their ticks - Optionally carrying a
+///   payload along with each value, e.g:
+///     TimeSort::SortByTime(dateTimes);
+///     TimeSort::SortByTime(std::span(timestamps), std::span(events));
+///
+///   The sorts are LSD radix sorts of the ticks with 8 bits digits. The
+///   histograms of all the digits are built in a single pass and the
+///   digits where every value is the same are skipped - So values spread
+///   over a few days (~40 bits of ticks) take 5 passes instead of 8.
+///   They are stable: DateTimes with the same ticks (but different kinds)
+///   keep their order. Payloads must be default constructible and movable.
+///
+///   The parallel versions first partition the values by their highest
+///   varying digit (each thread scattering its own chunk) and then sort
+///   the partitions in parallel. Values that fall in a single partition
+///   are sorted by a single thread.
+class TimeSort
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+private:
+    struct NoPayload {};
+
+    static constexpr int    k_digit_bits      = 8;
+    static constexpr int    k_bucket_count    = 1 << k_digit_bits;
+    static constexpr size_t k_small_count     = 64;
+    static constexpr size_t k_parallel_count  = 1 << 16;
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Sorts the given values by their ticks.
+    static void SortByTime(std::span<DateTime> values);
+    static void SortByTime(std::span<TimeSpan> values);
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Sorts the given keys by their ticks, moving payloads[i] along with
+    ///   keys[i]. Throws std::invalid_argument if the sizes don't match.
+    template <typename TPayload>
+    static void SortByTime(std::span<DateTime> keys, std::span<TPayload> payloads)
+    {
+        CheckSizes(keys.size(), payloads.size());
+        Sort(keys.data(), payloads.data(), keys.size(), 1);
+    }
+
+    template <typename TPayload>
+    static void SortByTime(std::span<TimeSpan> keys, std::span<TPayload> payloads)
+    {
+        CheckSizes(keys.size(), payloads.size());
+        Sort(keys.data(), payloads.data(), keys.size(), 1);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as SortByTime using the given number of threads - Zero uses
+    ///   one per hardware thread.
+    static void ParallelSortByTime(std::span<DateTime> values, unsigned threadCount = 0);
+    static void ParallelSortByTime(std::span<TimeSpan> values, unsigned threadCount = 0);
+
+    template <typename TPayload>
+    static void ParallelSortByTime(
+        std::span<DateTime>  keys,
+        std::span<TPayload>  payloads,
+        unsigned             threadCount = 0)
+    {
+        CheckSizes(keys.size(), payloads.size());
+        Sort(keys.data(), payloads.data(), keys.size(), threadCount);
+    }
+
+    template <typename TPayload>
+    static void ParallelSortByTime(
+        std::span<TimeSpan>  keys,
+        std::span<TPayload>  payloads,
+        unsigned             threadCount = 0)
+    {
+        CheckSizes(keys.size(), payloads.size());
+        Sort(keys.data(), payloads.data(), keys.size(), threadCount);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    static void CheckSizes(size_t keyCount, size_t payloadCount)
+    {
+        if(keyCount != payloadCount)
+            throw std::invalid_argument("TimeSort - Keys and payloads sizes don't match");
+    }
+
+    //--------------------------------------------------------------------------
+    // Unsigned keys with the same order as the ticks. DateTime ticks are its
+    // lower 62 bits (two's complement), so biasing them by 2^61 gives them
+    // in [0, 2^62) - And drops the kind bits.
+    static std::uint64_t SortKey(const DateTime &value)
+    {
+        return (std::bit_cast<std::uint64_t>(value) + (std::uint64_t(1) << 61))
+             & ((std::uint64_t(1) << 62) - 1);
+    }
+
+    static std::uint64_t SortKey(const TimeSpan &value)
+    {
+        return std::uint64_t(value.Ticks()) ^ (std::uint64_t(1) << 63);
+    }
+
+    //--------------------------------------------------------------------------
+    template <typename TKey, typename TPayload>
+    static void Sort(TKey *keys, TPayload *payloads, size_t count, unsigned threadCount)
+    {
+        if(threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        if(count < 2)
+            return;
+
+        //----------------------------------------------------------------------
+        // Values only come from keys, so a copy is as good as any storage.
+        auto key_buffer     = std::vector<TKey>(keys, keys + count);
+        auto payload_buffer = std::vector<TPayload>(
+            std::is_same_v<TPayload, NoPayload> ? 0 : count
+        );
+
+        if(threadCount == 1 || count < k_parallel_count)
+        {
+            LsdSort(keys, payloads, key_buffer.data(), payload_buffer.data(), count, 64);
+            return;
+        }
+
+        PartitionSort(
+            keys,
+            payloads,
+            key_buffer.data(),
+            payload_buffer.data(),
+            count,
+            threadCount
+        );
+    }
+
+    //--------------------------------------------------------------------------
+    // Sorts by the lower bits of the keys (the upper ones being the same),
+    // using the buffers as scratch.
+    template <typename TKey, typename TPayload>
+    static void LsdSort(
+        TKey     *keys,
+        TPayload *payloads,
+        TKey     *keyBuffer,
+        TPayload *payloadBuffer,
+        size_t   count,
+        int      bits)
+    {
+        constexpr auto k_has_payload = !std::is_same_v<TPayload, NoPayload>;
+
+        if(count <= k_small_count)
+        {
+            InsertionSort(keys, payloads, count);
+            return;
+        }
+
+        auto   digits = (bits + k_digit_bits - 1) / k_digit_bits;
+        size_t counts[64 / k_digit_bits][k_bucket_count] = {};
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            auto key = SortKey(keys[i]);
+            for(int digit = 0; digit < digits; ++digit)
+                ++counts[digit][(key >> (digit * k_digit_bits)) & (k_bucket_count - 1)];
+        }
+
+        auto src_keys     = keys;
+        auto dst_keys     = keyBuffer;
+        auto src_payloads = payloads;
+        auto dst_payloads = payloadBuffer;
+        auto swapped      = false;
+
+        for(int digit = 0; digit < digits; ++digit)
+        {
+            auto shift = digit * k_digit_bits;
+
+            //------------------------------------------------------------------
+            // Every value has the same digit - Nothing to move.
+            auto first_digit = (SortKey(keys[0]) >> shift) & (k_bucket_count - 1);
+            if(counts[digit][first_digit] == count)
+                continue;
+
+            size_t offsets[k_bucket_count];
+            size_t offset = 0;
+            for(int bucket = 0; bucket < k_bucket_count; ++bucket)
+            {
+                offsets[bucket] = offset;
+                offset         += counts[digit][bucket];
+            }
+
+            for(size_t i = 0; i < count; ++i)
+            {
+                auto bucket = (SortKey(src_keys[i]) >> shift) & (k_bucket_count - 1);
+                auto index  = offsets[bucket]++;
+
+                dst_keys[index] = src_keys[i];
+                if constexpr(k_has_payload)
+                    dst_payloads[index] = std::move(src_payloads[i]);
+            }
+
+            if(!swapped)
+            {
+                src_keys = keyBuffer;  src_payloads = payloadBuffer;
+                dst_keys = keys;       dst_payloads = payloads;
+            }
+            else
+            {
+                src_keys = keys;       src_payloads = payloads;
+                dst_keys = keyBuffer;  dst_payloads = payloadBuffer;
+            }
+            swapped = !swapped;
+        }
+
+        if(swapped)
+        {
+            std::copy(keyBuffer, keyBuffer + count, keys);
+            if constexpr(k_has_payload)
+                std::move(payloadBuffer, payloadBuffer + count, payloads);
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    template <typename TKey, typename TPayload>
+    static void InsertionSort(TKey *keys, TPayload *payloads, size_t count)
+    {
+        for(size_t i = 1; i < count; ++i)
+        {
+            auto key       = keys[i];
+            auto sort_key  = SortKey(key);
+            auto j         = i;
+
+            if constexpr(!std::is_same_v<TPayload, NoPayload>)
+            {
+                auto payload = std::move(payloads[i]);
+                for(; j > 0 && SortKey(keys[j - 1]) > sort_key; --j)
+                {
+                    keys    [j] = keys[j - 1];
+                    payloads[j] = std::move(payloads[j - 1]);
+                }
+                payloads[j] = std::move(payload);
+            }
+            else
+            {
+                for(; j > 0 && SortKey(keys[j - 1]) > sort_key; --j)
+                    keys[j] = keys[j - 1];
+            }
+
+            keys[j] = key;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    template <typename TFunction>
+    static void RunThreads(unsigned threadCount, TFunction function)
+    {
+        auto threads = std::vector<std::thread>();
+        threads.reserve(threadCount);
+
+        for(unsigned thread = 0; thread < threadCount; ++thread)
+            threads.emplace_back(function, thread);
+        for(auto &thread : threads)
+            thread.join();
+    }
+
+    //--------------------------------------------------------------------------
+    // MSD partition by the highest varying digit into the buffers and then
+    // LSD sort of each partition back into keys.
+    template <typename TKey, typename TPayload>
+    static void PartitionSort(
+        TKey     *keys,
+        TPayload *payloads,
+        TKey     *keyBuffer,
+        TPayload *payloadBuffer,
+        size_t   count,
+        unsigned threadCount)
+    {
+        constexpr auto k_has_payload = !std::is_same_v<TPayload, NoPayload>;
+
+        auto chunk_first = [&](unsigned thread) {
+            return count * thread / threadCount;
+        };
+
+        //----------------------------------------------------------------------
+        // Bits that vary between the keys.
+        auto diffs = std::vector<std::uint64_t>(threadCount, 0);
+        RunThreads(threadCount, [&](unsigned thread) {
+            auto first = SortKey(keys[0]);
+            auto diff  = std::uint64_t(0);
+            for(auto i = chunk_first(thread); i < chunk_first(thread + 1); ++i)
+                diff |= SortKey(keys[i]) ^ first;
+
+            diffs[thread] = diff;
+        });
+
+        auto diff = std::uint64_t(0);
+        for(auto value : diffs)
+            diff |= value;
+        if(diff == 0)
+            return;
+
+        auto high  = 63 - std::countl_zero(diff);
+        auto shift = std::max(high + 1 - k_digit_bits, 0);
+
+        //----------------------------------------------------------------------
+        // Histograms of each chunk and where each chunk writes each bucket.
+        auto counts = std::vector<size_t>(size_t(threadCount) * k_bucket_count, 0);
+        RunThreads(threadCount, [&](unsigned thread) {
+            auto chunk_counts = counts.data() + size_t(thread) * k_bucket_count;
+            for(auto i = chunk_first(thread); i < chunk_first(thread + 1); ++i)
+                ++chunk_counts[(SortKey(keys[i]) >> shift) & (k_bucket_count - 1)];
+        });
+
+        auto starts = std::vector<size_t>(k_bucket_count + 1, 0);
+        auto offset = size_t(0);
+        for(int bucket = 0; bucket < k_bucket_count; ++bucket)
+        {
+            starts[bucket] = offset;
+            for(unsigned thread = 0; thread < threadCount; ++thread)
+            {
+                auto &chunk_count = counts[size_t(thread) * k_bucket_count + bucket];
+                auto chunk_size   = chunk_count;
+
+                chunk_count = offset;   // Now the chunk write offset.
+                offset     += chunk_size;
+            }
+        }
+        starts[k_bucket_count] = count;
+
+        RunThreads(threadCount, [&](unsigned thread) {
+            auto offsets = counts.data() + size_t(thread) * k_bucket_count;
+            for(auto i = chunk_first(thread); i < chunk_first(thread + 1); ++i)
+            {
+                auto index = offsets[(SortKey(keys[i]) >> shift) & (k_bucket_count - 1)]++;
+
+                keyBuffer[index] = keys[i];
+                if constexpr(k_has_payload)
+                    payloadBuffer[index] = std::move(payloads[i]);
+            }
+        });
+
+        //----------------------------------------------------------------------
+        // Each partition only differs on the bits below the shift - The
+        // threads take them in order until there are none left.
+        auto next_bucket = std::atomic<int>(0);
+        RunThreads(threadCount, [&](unsigned) {
+            for(auto bucket = next_bucket++; bucket < k_bucket_count; bucket = next_bucket++)
+            {
+                auto first = starts[bucket];
+                auto size  = starts[bucket + 1] - first;
+                if(size == 0)
+                    continue;
+
+                LsdSort(
+                    keyBuffer     + first,
+                    payloadBuffer + (k_has_payload ? first : 0),
+                    keys          + first,
+                    payloads      + (k_has_payload ? first : 0),
+                    size,
+                    shift
+                );
+
+                std::copy(keyBuffer + first, keyBuffer + first + size, keys + first);
+                if constexpr(k_has_payload)
+                {
+                    std::move(
+                        payloadBuffer + first,
+                        payloadBuffer + first + size,
+                        payloads      + first
+                    );
+                }
+            }
+        });
+    }
+};
+
+NS_CORETIME_END
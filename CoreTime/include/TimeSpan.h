@@ -1,8 +1,12 @@
 #pragma once
 
 // std
+#include <chrono>
+#include <cstdint>
 #include <ctime>
+#include <limits>
 #include <string>
+#include <type_traits>
 // CoreTime
 #include "CoreTime_Utils.h"
 
@@ -18,12 +22,18 @@ public:
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Represents the maximum TimeSpan value. This field is read-only.
-    static const TimeSpan& MaxValue();
+    static constexpr TimeSpan MaxValue()
+    {
+        return TimeSpan(std::numeric_limits<time_t>::max());
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Represents the minimum TimeSpan value. This field is read-only.
-    static const TimeSpan& MinValue();
+    static constexpr TimeSpan MinValue()
+    {
+        return TimeSpan(std::numeric_limits<time_t>::min());
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
@@ -51,10 +61,19 @@ public:
     ///   Represents the number of ticks in 1 day. This field is constant.
     static constexpr time_t TicksPerDay = TicksPerHour * 24;
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The std::chrono duration with the same representation as
+    ///   TimeSpan - Converting between them is a plain integer copy.
+    typedef std::chrono::duration<
+        std::int64_t,
+        std::ratio<1, TicksPerSecond>
+    > duration_t;
+
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Represents the zero TimeSpan value. This field is read-only.
-    static const TimeSpan& Zero();
+    static constexpr TimeSpan Zero() { return TimeSpan(0); }
 
 
     //------------------------------------------------------------------------//
@@ -65,30 +84,64 @@ public:
     /// @brief
     ///   Initializes a new instance of the TimeSpan structure to a
     ///   specified number of hours, minutes, and seconds.
-    TimeSpan(time_t hours, time_t minutes, time_t seconds);
+    constexpr TimeSpan(time_t hours, time_t minutes, time_t seconds) :
+        TimeSpan(0, hours, minutes, seconds)
+    {
+        // Empty...
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Initializes a new instance of the TimeSpan structure to
     ///   a specified number of days, hours, minutes, and seconds.
-    TimeSpan(time_t days, time_t hours, time_t minutes, time_t seconds);
+    constexpr TimeSpan(time_t days, time_t hours, time_t minutes, time_t seconds) :
+        TimeSpan(days, hours, minutes, seconds, 0)
+    {
+        // Empty...
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Initializes a new instance of the TimeSpan structure to a specified
     ///   number of days, hours, minutes, seconds, and milliseconds.
-    TimeSpan(
+    constexpr TimeSpan(
         time_t days,
         time_t hours,
         time_t minutes,
         time_t seconds,
-        time_t milliseconds);
+        time_t milliseconds) :
+        m_ticks(
+            days         * TicksPerDay
+          + hours        * TicksPerHour
+          + minutes      * TicksPerMinute
+          + seconds      * TicksPerSecond
+          + milliseconds * TicksPerMillisecond
+        )
+    {
+        // Empty...
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Initializes a new instance of the TimeSpan structure to the
     ///   specified number of ticks.
-    TimeSpan(time_t ticks);
+    constexpr TimeSpan(time_t ticks) :
+        m_ticks(ticks)
+    {
+        // Empty...
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new instance of the TimeSpan structure to the given
+    ///   std::chrono duration. Durations finer than a tick are truncated
+    ///   towards zero.
+    template <typename TRep, typename TPeriod>
+    explicit constexpr TimeSpan(const std::chrono::duration<TRep, TPeriod> &duration) :
+        m_ticks(std::chrono::duration_cast<duration_t>(duration).count())
+    {
+        // Empty...
+    }
 
 
     //------------------------------------------------------------------------//
@@ -99,74 +152,85 @@ public:
     /// @brief
     ///   Gets the days component of the time interval represented by
     ///   the current TimeSpan structure.
-    inline time_t Days() const { return m_days; }
+    constexpr time_t Days() const { return m_ticks / TicksPerDay; }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the hours component of the time interval represented by the
     ///   current TimeSpan structure.
-    inline time_t Hours() const { return m_hours; }
+    constexpr time_t Hours() const { return (m_ticks / TicksPerHour) % 24; }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the milliseconds component of the time interval represented by
     ///   the current TimeSpan structure.
-    inline time_t Milliseconds() const { return m_milliseconds; }
+    constexpr time_t Milliseconds() const
+    {
+        return (m_ticks / TicksPerMillisecond) % 1000;
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the minutes component of the time interval represented by the
     ///   current TimeSpan structure.
-    inline time_t Minutes() const { return m_minutes; }
+    constexpr time_t Minutes() const { return (m_ticks / TicksPerMinute) % 60; }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the seconds component of the time interval represented by the
     ///   current TimeSpan structure.
-    inline time_t Seconds() const { return m_seconds; }
+    constexpr time_t Seconds() const { return (m_ticks / TicksPerSecond) % 60; }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the number of ticks that represent the value of the current
     ///   TimeSpan structure.
-    inline time_t Ticks() const
-    {
-        return m_days         * TicksPerDay
-             + m_hours        * TicksPerHour
-             + m_minutes      * TicksPerMinute
-             + m_seconds      * TicksPerSecond
-             + m_milliseconds * TicksPerMillisecond;
-    }
+    constexpr time_t Ticks() const { return m_ticks; }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the value of the current TimeSpan structure expressed in
     ///   whole and fractional days.
-    inline double TotalDays() const { return Ticks() / TicksPerDay; }
+    constexpr double TotalDays() const
+    {
+        return double(m_ticks) / TicksPerDay;
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the value of the current TimeSpan structure expressed in
     ///   whole and fractional hours.
-    inline double TotalHours() const { return Ticks() / TicksPerHour; }
+    constexpr double TotalHours() const
+    {
+        return double(m_ticks) / TicksPerHour;
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the value of the current TimeSpan structure expressed in
     ///   whole and fractional milliseconds.
-    inline double TotalMilliseconds() const { return Ticks() / TicksPerMillisecond; }
+    constexpr double TotalMilliseconds() const
+    {
+        return double(m_ticks) / TicksPerMillisecond;
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the value of the current TimeSpan structure expressed in
     ///   whole and fractional minutes.
-    inline double TotalMinutes() const { return Ticks() / TicksPerMinute; }
+    constexpr double TotalMinutes() const
+    {
+        return double(m_ticks) / TicksPerMinute;
+    }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Gets the value of the current TimeSpan structure expressed in
     ///   whole and fractional seconds.
-    inline double TotalSeconds() const { return Ticks() / TicksPerSecond; }
+    constexpr double TotalSeconds() const
+    {
+        return double(m_ticks) / TicksPerSecond;
+    }
 
 
     //------------------------------------------------------------------------//
@@ -177,19 +241,20 @@ public:
     /// @brief
     ///   Returns a new TimeSpan object whose value is the sum of the specified
     ///   TimeSpan object and this instance.
-    inline TimeSpan Add(const TimeSpan &timeSpan) const
+    constexpr TimeSpan Add(const TimeSpan &timeSpan) const
     {
-        return TimeSpan(*this + timeSpan);
+        return TimeSpan(m_ticks + timeSpan.m_ticks);
     }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Compares two TimeSpan values and returns an integer that indicates
     ///   whether the first value is shorter than, equal to, or longer than
-    ///   the second value.
-    inline static time_t Compare(const TimeSpan &lhs, const TimeSpan &rhs)
+    ///   the second value - Respectively -1, 0 or 1.
+    constexpr static time_t Compare(const TimeSpan &lhs, const TimeSpan &rhs)
     {
-        return (lhs.Ticks() - rhs.Ticks());
+        // Not the difference - It overflows for far apart values.
+        return (lhs.m_ticks > rhs.m_ticks) - (lhs.m_ticks < rhs.m_ticks);
     }
 
     ///-------------------------------------------------------------------------
@@ -197,7 +262,7 @@ public:
     ///   Compares this instance to a specified TimeSpan object and returns an
     ///   integer that indicates whether this instance is shorter than, equal to,
     ///   or longer than the TimeSpan object.
-    inline time_t CompareTo(const TimeSpan &rhs) const
+    constexpr time_t CompareTo(const TimeSpan &rhs) const
     {
         return Compare(*this, rhs);
     }
@@ -206,70 +271,69 @@ public:
     /// @brief
     ///   Returns a new TimeSpan object whose value is the absolute value of the
     ///   current TimeSpan object.
-    TimeSpan Duration() const
+    constexpr TimeSpan Duration() const
     {
-        auto ticks = Ticks();
-        return TimeSpan((ticks < 0) ? -ticks : ticks);
+        return TimeSpan((m_ticks < 0) ? -m_ticks : m_ticks);
     }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a value that indicates whether two specified instances of
     ///   TimeSpan are equal.
-    static bool Equals(const TimeSpan &lhs, const TimeSpan &rhs)
+    constexpr static bool Equals(const TimeSpan &lhs, const TimeSpan &rhs)
     {
-        return lhs.Ticks() == rhs.Ticks();
+        return lhs.m_ticks == rhs.m_ticks;
     }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a TimeSpan that represents a specified number of days, where
     ///   the specification is accurate to the nearest millisecond.
-    inline static TimeSpan FromDays(double days)
+    constexpr static TimeSpan FromDays(double days)
     {
-        return TimeSpan(days * TicksPerDay);
+        return TimeSpan(time_t(days * TicksPerDay));
     }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a TimeSpan that represents a specified number of hours,
     ///   where the specification is accurate to the nearest millisecond.
-    inline static TimeSpan FromHours(double hours)
+    constexpr static TimeSpan FromHours(double hours)
     {
-        return TimeSpan(hours * TicksPerHour);
+        return TimeSpan(time_t(hours * TicksPerHour));
     }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a TimeSpan that represents a specified number of milliseconds.
-    inline static TimeSpan FromMilliseconds(double ms)
+    constexpr static TimeSpan FromMilliseconds(double ms)
     {
-        return TimeSpan(ms * TicksPerMillisecond);
+        return TimeSpan(time_t(ms * TicksPerMillisecond));
     }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a TimeSpan that represents a specified number of minutes,
     ///   where the specification is accurate to the nearest millisecond.
-    inline static TimeSpan FromMinutes(double minutes)
-{
-        return TimeSpan(minutes * TicksPerMinute);
+    constexpr static TimeSpan FromMinutes(double minutes)
+    {
+        return TimeSpan(time_t(minutes * TicksPerMinute));
     }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a TimeSpan that represents a specified number of seconds,
     ///   where the specification is accurate to the nearest millisecond.
-    inline static TimeSpan FromSeconds(double seconds)
+    constexpr static TimeSpan FromSeconds(double seconds)
     {
-        return TimeSpan(seconds * TicksPerSecond);
+        return TimeSpan(time_t(seconds * TicksPerSecond));
     }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a TimeSpan that represents a specified time, where the
     ///   specification is in units of ticks.
-    inline static TimeSpan FromTicks(time_t ticks)
+    constexpr static TimeSpan FromTicks(time_t ticks)
     {
         return TimeSpan(ticks);
     }
@@ -278,118 +342,120 @@ public:
     /// @brief
     ///   Returns a new TimeSpan object whose value is the negated value
     ///   of this instance.
-    inline TimeSpan Negate() const { return TimeSpan(-Ticks()); }
+    constexpr TimeSpan Negate() const { return TimeSpan(-m_ticks); }
 
     ///-------------------------------------------------------------------------
     /// @brief
     ///   Returns a new TimeSpan object whose value is the difference between
     ///   the specified TimeSpan object and this instance.
-    TimeSpan Subtract(const TimeSpan &rhs) const
+    constexpr TimeSpan Subtract(const TimeSpan &rhs) const
     {
-        return TimeSpan(*this - rhs);
+        return TimeSpan(m_ticks - rhs.m_ticks);
     }
 
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts this instance to the equivalent std::chrono duration.
+    ///   Use std::chrono::duration_cast on the result for other periods.
+    constexpr duration_t ToChrono() const { return duration_t(m_ticks); }
+
 
     //------------------------------------------------------------------------//
     // Operators                                                              //
     //------------------------------------------------------------------------//
 public:
-    friend bool operator < (const TimeSpan &lhs, const TimeSpan &rhs);
-    friend bool operator > (const TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr bool operator < (const TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr bool operator > (const TimeSpan &lhs, const TimeSpan &rhs);
 
-    friend bool operator <=(const TimeSpan &lhs, const TimeSpan &rhs);
-    friend bool operator >=(const TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr bool operator <=(const TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr bool operator >=(const TimeSpan &lhs, const TimeSpan &rhs);
 
-    friend bool operator ==(const TimeSpan &lhs, const TimeSpan &rhs);
-    friend bool operator !=(const TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr bool operator ==(const TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr bool operator !=(const TimeSpan &lhs, const TimeSpan &rhs);
 
-    friend TimeSpan operator + (const TimeSpan &lhs, const TimeSpan &rhs);
-    friend TimeSpan operator - (const TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr TimeSpan operator + (const TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr TimeSpan operator - (const TimeSpan &lhs, const TimeSpan &rhs);
 
-    friend TimeSpan& operator +=(TimeSpan &lhs, const TimeSpan &rhs);
-    friend TimeSpan& operator -=(TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr TimeSpan& operator +=(TimeSpan &lhs, const TimeSpan &rhs);
+    friend constexpr TimeSpan& operator -=(TimeSpan &lhs, const TimeSpan &rhs);
 
 
     //------------------------------------------------------------------------//
     // iVars                                                                  //
     //------------------------------------------------------------------------//
 private:
-    time_t m_days;
-    time_t m_hours;
-    time_t m_minutes;
-    time_t m_seconds;
-    time_t m_milliseconds;
+    time_t m_ticks;
 };
 
+//------------------------------------------------------------------------------
+// TimeSpan is meant to be passed around and stored in bulk as a plain
+// tick count - Keep it that way.
+static_assert(sizeof(TimeSpan) == sizeof(time_t));
+static_assert(std::is_trivially_copyable<TimeSpan>::value);
+
+
 //----------------------------------------------------------------------------//
 // Operators                                                                  //
 //----------------------------------------------------------------------------//
 //------------------------------------------------------------------------------
-inline bool operator <(const TimeSpan &lhs, const TimeSpan &rhs)
+constexpr bool operator <(const TimeSpan &lhs, const TimeSpan &rhs)
 {
-    return lhs.Ticks() < rhs.Ticks();
+    return lhs.m_ticks < rhs.m_ticks;
 }
 
 //------------------------------------------------------------------------------
-inline bool operator >(const TimeSpan &lhs, const TimeSpan &rhs)
+constexpr bool operator >(const TimeSpan &lhs, const TimeSpan &rhs)
 {
-    return lhs.Ticks() > rhs.Ticks();
+    return lhs.m_ticks > rhs.m_ticks;
 }
 
 //------------------------------------------------------------------------------
-inline bool operator <=(const TimeSpan &lhs, const TimeSpan &rhs)
+constexpr bool operator <=(const TimeSpan &lhs, const TimeSpan &rhs)
 {
-    return lhs.Ticks() <= rhs.Ticks();
+    return lhs.m_ticks <= rhs.m_ticks;
 }
 
 //------------------------------------------------------------------------------
-inline bool operator >=(const TimeSpan &lhs, const TimeSpan &rhs)
+constexpr bool operator >=(const TimeSpan &lhs, const TimeSpan &rhs)
 {
-    return lhs.Ticks() >= rhs.Ticks();
+    return lhs.m_ticks >= rhs.m_ticks;
 }
 
 //------------------------------------------------------------------------------
-inline bool operator ==(const TimeSpan &lhs, const TimeSpan &rhs)
+constexpr bool operator ==(const TimeSpan &lhs, const TimeSpan &rhs)
 {
-    return lhs.Ticks() == rhs.Ticks();
+    return lhs.m_ticks == rhs.m_ticks;
 }
 
 //------------------------------------------------------------------------------
-inline bool operator !=(const TimeSpan &lhs, const TimeSpan &rhs)
+constexpr bool operator !=(const TimeSpan &lhs, const TimeSpan &rhs)
 {
-    return lhs.Ticks() != rhs.Ticks();
+    return lhs.m_ticks != rhs.m_ticks;
 }
 
-inline TimeSpan operator +(const TimeSpan &lhs, const TimeSpan &rhs)
+//------------------------------------------------------------------------------
+constexpr TimeSpan operator +(const TimeSpan &lhs, const TimeSpan &rhs)
 {
-    return TimeSpan(lhs.Ticks() + rhs.Ticks());
+    return TimeSpan(lhs.m_ticks + rhs.m_ticks);
 }
 
-inline TimeSpan operator -(const TimeSpan &lhs, const TimeSpan &rhs)
+//------------------------------------------------------------------------------
+constexpr TimeSpan operator -(const TimeSpan &lhs, const TimeSpan &rhs)
 {
-    return TimeSpan(lhs.Ticks() - rhs.Ticks());
+    return TimeSpan(lhs.m_ticks - rhs.m_ticks);
 }
 
-
-inline TimeSpan& operator +=(TimeSpan &lhs, const TimeSpan &rhs)
+//------------------------------------------------------------------------------
+constexpr TimeSpan& operator +=(TimeSpan &lhs, const TimeSpan &rhs)
 {
-    lhs.m_days         += rhs.m_days;
-    lhs.m_hours        += rhs.m_hours;
-    lhs.m_minutes      += rhs.m_minutes;
-    lhs.m_seconds      += rhs.m_seconds;
-    lhs.m_milliseconds += rhs.m_milliseconds;
-
+    lhs.m_ticks += rhs.m_ticks;
     return lhs;
 }
 
-inline TimeSpan& operator -=(TimeSpan &lhs, const TimeSpan &rhs)
+//------------------------------------------------------------------------------
+constexpr TimeSpan& operator -=(TimeSpan &lhs, const TimeSpan &rhs)
 {
-    lhs.m_days         -= rhs.m_days;
-    lhs.m_hours        -= rhs.m_hours;
-    lhs.m_minutes      -= rhs.m_minutes;
-    lhs.m_seconds      -= rhs.m_seconds;
-    lhs.m_milliseconds -= rhs.m_milliseconds;
-
+    lhs.m_ticks -= rhs.m_ticks;
     return lhs;
 }
 
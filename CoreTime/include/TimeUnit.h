@@ -0,0 +1,79 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A whole number of a fixed time unit, e.g. Days{3} or Hours{12}.
+///   The unit is part of the type, so converting it to ticks is a single
+///   integer multiplication by a compile time constant - Use it instead
+///   of the double based DateTime::AddDays / AddHours / ... e.g:
+///     dateTime.Add(Days{3});
+///     dateTime.Add<Hours>(12);
+template <time_t TTicksPerUnit>
+class TimeUnit
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr time_t TicksPerUnit = TTicksPerUnit;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit constexpr TimeUnit(std::int64_t count) :
+        m_count(count)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of units of this instance.
+    constexpr std::int64_t Count() const { return m_count; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of ticks of this instance.
+    constexpr time_t Ticks() const { return m_count * TicksPerUnit; }
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    constexpr operator TimeSpan() const { return TimeSpan(Ticks()); }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::int64_t m_count;
+};
+
+typedef TimeUnit<1>                             Ticks;
+typedef TimeUnit<TimeSpan::TicksPerMillisecond> Milliseconds;
+typedef TimeUnit<TimeSpan::TicksPerSecond>      Seconds;
+typedef TimeUnit<TimeSpan::TicksPerMinute>      Minutes;
+typedef TimeUnit<TimeSpan::TicksPerHour>        Hours;
+typedef TimeUnit<TimeSpan::TicksPerDay>         Days;
+typedef TimeUnit<TimeSpan::TicksPerDay * 7>     Weeks;
+
+NS_CORETIME_END
@@ -0,0 +1,223 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   An IANA time zone loaded from a TZif file (RFC 8536).
+///
+///   Each zone is parsed once into a compact table of transitions, looked
+///   up with a binary search and a per thread cache of the last period hit
+///   in each zone, and extended past its last transition with the POSIX TZ
+///   rule of the file footer. No libc time function (and so no libc lock or TZ read)
+///   is used after loading.
+///
+///   Zones are never destroyed, so the references and pointers returned
+///   here are valid for the whole program.
+///
+///   Zones are immutable after loading - Every method can be called from
+///   any number of threads at once. The period cache is thread_local and
+///   the zone lookup is guarded by a mutex.
+class TimeZone
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   A span of time with a constant offset from UTC.
+    struct Period
+    {
+        time_t       from;      ///< UTC ticks - Inclusive.
+        time_t       until;     ///< UTC ticks - Exclusive.
+        std::int32_t utcOffset; ///< Seconds east of UTC.
+        bool         isDst;
+    };
+
+private:
+    struct LocalTimeType
+    {
+        std::int32_t utcOffset; ///< Seconds east of UTC.
+        bool         isDst;
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   A date of a POSIX TZ rule - Jn, n or Mm.w.d.
+    struct RuleDate
+    {
+        enum class Type { JulianNoLeap, JulianZeroBased, MonthWeekDay };
+
+        Type         type;
+        std::int32_t day;       ///< Jn / n / d of Mm.w.d
+        std::int32_t week;      ///< w of Mm.w.d
+        std::int32_t month;     ///< m of Mm.w.d
+        std::int32_t time;      ///< Seconds of local time.
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   The POSIX TZ rule (e.g. CET-1CEST,M3.5.0,M10.5.0/3).
+    struct Rule
+    {
+        std::int32_t stdOffset; ///< Seconds east of UTC.
+        std::int32_t dstOffset; ///< Seconds east of UTC.
+        bool         hasDst;
+        RuleDate     dstStart;
+        RuleDate     dstEnd;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+private:
+    TimeZone(const std::string &id);
+
+public:
+    TimeZone(const TimeZone &) = delete;
+    TimeZone& operator =(const TimeZone &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Zones                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the Coordinated Universal Time (UTC) zone.
+    static const TimeZone& Utc();
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the local zone of this computer - Given by the TZ environment
+    ///   variable (a zone id, a TZif path or a POSIX TZ string) or by
+    ///   /etc/localtime. Falls back to UTC.
+    ///   It is read only once, changing TZ afterwards has no effect.
+    static const TimeZone& Local();
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the zone with the given IANA id (e.g. "America/Sao_Paulo")
+    ///   from the zoneinfo directory ($TZDIR or /usr/share/zoneinfo).
+    ///   Returns nullptr if there is no such zone.
+    ///   Each zone is loaded only once - Keep the returned pointer instead
+    ///   of looking it up on hot paths.
+    static const TimeZone* FindSystemTimeZoneById(const std::string &id);
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the id of this zone.
+    const std::string& Id() const { return m_id; }
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the period with a constant offset that contains the given
+    ///   UTC ticks.
+    Period GetPeriod(time_t utcTicks) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the offset (in ticks) from UTC at the given UTC ticks.
+    time_t UtcOffsetTicks(time_t utcTicks) const
+    {
+        return time_t(GetPeriod(utcTicks).utcOffset) * TimeSpan::TicksPerSecond;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts ticks of the local time of this zone to UTC ticks.
+    ///   Ambiguous local times resolve to the earliest instant and
+    ///   skipped ones are moved forward by the length of the gap.
+    time_t ToUtcTicks(time_t localTicks) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the offset from UTC of this zone at the given DateTime.
+    ///   DateTimes of DateTimeKind::None are taken as local times
+    ///   of this zone.
+    TimeSpan GetUtcOffset(const DateTime &dateTime) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Indicates whether the given DateTime is within the daylight saving
+    ///   time of this zone. DateTimes of DateTimeKind::None are taken as
+    ///   local times of this zone.
+    bool IsDaylightSavingTime(const DateTime &dateTime) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts the given DateTime to the local time of this zone. The
+    ///   result has DateTimeKind::None. DateTimes of DateTimeKind::None are
+    ///   taken as UTC.
+    DateTime ConvertFromUtc(const DateTime &dateTime) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts the given local time of this zone to UTC. DateTimes that
+    ///   are already UTC or Local are only relabeled as UTC.
+    DateTime ConvertToUtc(const DateTime &dateTime) const;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Converts the given DateTime from the given zone to the
+    ///   local time of another zone.
+    static DateTime ConvertTime(
+        const DateTime &dateTime,
+        const TimeZone &sourceZone,
+        const TimeZone &destinationZone);
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    static TimeZone* LoadFile      (const std::string &id, const std::string &path);
+    static TimeZone* LoadPosixRule (const std::string &id, const std::string &tz);
+
+    bool ParseTZif     (const std::vector<std::uint8_t> &data);
+    bool ParsePosixRule(const std::string &tz);
+
+    Period RulePeriod    (time_t utcTicks) const;
+    time_t RuleDateToUtc (time_t year, const RuleDate &date, std::int32_t offset) const;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string m_id;
+
+    std::vector<time_t>        m_transitions;     // UTC ticks - Sorted.
+    std::vector<std::uint8_t>  m_transitionTypes; // Index on m_types.
+    std::vector<LocalTimeType> m_types;
+
+    bool m_hasRule;
+    Rule m_rule;
+
+    std::uint32_t m_cacheSlot; // In the per thread period caches.
+};
+
+NS_CORETIME_END
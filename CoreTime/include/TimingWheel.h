@@ -0,0 +1,401 @@
+#pragma once
+
+// std
+#include <cstdint>
+#include <ctime>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+// CoreTime
+#include "CoreTime_Utils.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+
+
+NS_CORETIME_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A hierarchical timing wheel - Schedules payloads to expire at given
+///   DateTimes with O(1) insert and cancel.
+///
+///   Time is counted in units of the wheel resolution since its start.
+///   There are 11 levels of 64 slots (covering the whole 64 bits of units),
+///   a timer goes to the level of the highest 6 bits group where its
+///   deadline differs from the current time and moves down the levels as
+///   the time gets close to it. Each level has a bitmap of its non empty
+///   slots, so advancing skips empty stretches of time at once.
+///
+///   Timers live in a pool of nodes linked by index - Canceled and expired
+///   nodes are reused, so after warming up (or Reserve) nothing allocates.
+///
+///   Deadlines are rounded up to the resolution, so timers never expire
+///   early. Local DateTimes hold UTC ticks, so any kind can be used as
+///   long as the wheel is advanced with the same kind.
+///
+///   A TimingWheel is not thread safe - Use one per thread.
+template <typename TPayload>
+class TimingWheel
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Identifies a scheduled timer. Ids of expired or canceled timers
+    ///   are never valid again, even when their node gets reused.
+    struct TimerId
+    {
+        std::uint32_t index;
+        std::uint32_t generation;
+    };
+
+private:
+    static constexpr int           k_slot_bits  = 6;
+    static constexpr int           k_slot_count = 1 << k_slot_bits;
+    static constexpr int           k_levels     = (64 + k_slot_bits - 1) / k_slot_bits;
+    static constexpr std::uint32_t k_null       = 0xFFFFFFFF;
+
+    struct Node
+    {
+        std::uint64_t deadline;   // Units since the start.
+        std::uint32_t prev;
+        std::uint32_t next;
+        std::uint32_t generation;
+        std::uint32_t slot;       // level * k_slot_count + slot - Or k_null.
+        TPayload      payload;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Initializes a new empty wheel at the given time, with the given
+    ///   resolution.
+    ///   Throws std::invalid_argument if the resolution isn't positive.
+    explicit TimingWheel(
+        const DateTime &start,
+        const TimeSpan &resolution = TimeSpan::FromTicks(TimeSpan::TicksPerMillisecond)) :
+        m_originTicks    (start.Ticks()),
+        m_resolutionTicks(CheckResolution(resolution)),
+        m_now            (0),
+        m_count          (0),
+        m_freeList       (k_null),
+        m_nodes          (),
+        m_expired        ()
+    {
+        for(auto &head : m_heads)
+            head = k_null;
+        for(auto &bitmap : m_bitmaps)
+            bitmap = 0;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the number of scheduled timers.
+    size_t Count() const { return m_count; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Gets the current time of the wheel - As of the last Advance.
+    DateTime Now() const
+    {
+        return DateTime(
+            m_originTicks + time_t(m_now) * m_resolutionTicks,
+            DateTime::DateTimeKind::UTC
+        );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Grows the node pool to hold the given number of timers.
+    void Reserve(size_t count) { m_nodes.reserve(count); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Schedules the payload to expire at the given deadline. Deadlines
+    ///   not after Now() expire on the next Advance.
+    TimerId Schedule(const DateTime &deadline, TPayload payload)
+    {
+        auto index = AllocateNode();
+        auto &node = m_nodes[index];
+
+        node.deadline = ToUnits(deadline.Ticks());
+        node.payload  = std::move(payload);
+
+        Link(index);
+        ++m_count;
+
+        return TimerId{ index, node.generation };
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Schedules the payload to expire after the given delay from Now().
+    TimerId Schedule(const TimeSpan &delay, TPayload payload)
+    {
+        return Schedule(Now().Add(delay), std::move(payload));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Cancels the given timer - Returns false if it has already expired
+    ///   or was canceled.
+    bool Cancel(const TimerId &timerId)
+    {
+        if(timerId.index >= m_nodes.size())
+            return false;
+
+        auto &node = m_nodes[timerId.index];
+        if(node.generation != timerId.generation || node.slot == k_null)
+            return false;
+
+        Unlink(timerId.index);
+        FreeNode(timerId.index);
+        --m_count;
+
+        return true;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Moves the wheel to the given time and calls the callback with the
+    ///   payload of each expired timer, in deadline order. Returns the
+    ///   number of expired timers.
+    ///   The callback can schedule and cancel timers - But timers that
+    ///   expired in the same call are delivered even if canceled.
+    template <typename TCallback>
+    size_t Advance(const DateTime &now, TCallback &&callback)
+    {
+        auto target = ToUnits(now.Ticks());
+
+        //----------------------------------------------------------------------
+        // Taken from the member so its capacity is reused, while still
+        // letting the callbacks call Advance.
+        auto expired = std::move(m_expired);
+        expired.clear();
+
+        while(m_now < target || HasDueSlot())
+        {
+            //------------------------------------------------------------------
+            // Find the earliest non empty slot - Lower levels first on ties.
+            auto best_level = -1;
+            auto best_start = std::uint64_t(0);
+            for(int level = 0; level < k_levels; ++level)
+            {
+                auto start = std::uint64_t(0);
+                if(NextSlotStart(level, start) && (best_level < 0 || start < best_start))
+                {
+                    best_level = level;
+                    best_start = start;
+                }
+            }
+
+            if(best_level < 0 || best_start > target)
+                break;
+
+            if(best_start > m_now)
+                m_now = best_start;
+
+            //------------------------------------------------------------------
+            // Level 0 slots hold a single deadline (the current time), the
+            // other ones are spread to the levels below.
+            auto slot  = best_level * k_slot_count + SlotOf(best_level, best_start);
+            auto index = m_heads[slot];
+
+            m_heads[slot] = k_null;
+            m_bitmaps[best_level] &= ~(std::uint64_t(1) << (slot % k_slot_count));
+
+            while(index != k_null)
+            {
+                auto next = m_nodes[index].next;
+                m_nodes[index].slot = k_null;
+
+                if(m_nodes[index].deadline <= m_now)
+                    expired.push_back(index);
+                else
+                    Link(index);
+
+                index = next;
+            }
+        }
+
+        if(m_now < target)
+            m_now = target;
+
+        //----------------------------------------------------------------------
+        // Release the nodes before the callbacks, so they can be reused
+        // by the timers that the callbacks schedule.
+        for(auto index : expired)
+        {
+            auto payload = std::move(m_nodes[index].payload);
+
+            FreeNode(index);
+            --m_count;
+
+            callback(payload);
+        }
+
+        auto expired_count = expired.size();
+        m_expired          = std::move(expired);
+
+        return expired_count;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    static time_t CheckResolution(const TimeSpan &resolution)
+    {
+        if(resolution.Ticks() <= 0)
+            throw std::invalid_argument("TimingWheel - Resolution must be positive");
+
+        return resolution.Ticks();
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint64_t ToUnits(time_t ticks) const
+    {
+        //----------------------------------------------------------------------
+        // Rounded up - A timer never expires before its deadline.
+        auto elapsed = ticks - m_originTicks;
+        if(elapsed <= 0)
+            return 0;
+
+        return std::uint64_t((elapsed + m_resolutionTicks - 1) / m_resolutionTicks);
+    }
+
+    static int SlotOf(int level, std::uint64_t units)
+    {
+        return int((units >> (level * k_slot_bits)) & (k_slot_count - 1));
+    }
+
+    //--------------------------------------------------------------------------
+    // Start of the first non empty slot of the level at or after the
+    // current slot of the level.
+    bool NextSlotStart(int level, std::uint64_t &start) const
+    {
+        auto current  = SlotOf(level, m_now);
+        auto occupied = m_bitmaps[level] & (~std::uint64_t(0) << current);
+        if(occupied == 0)
+            return false;
+
+        auto shift = level * k_slot_bits;
+        auto upper = (shift + k_slot_bits >= 64)
+            ? std::uint64_t(0)
+            : (m_now >> (shift + k_slot_bits)) << (shift + k_slot_bits);
+
+        start = upper | (std::uint64_t(__builtin_ctzll(occupied)) << shift);
+        return true;
+    }
+
+    bool HasDueSlot() const
+    {
+        return m_bitmaps[0] & (std::uint64_t(1) << SlotOf(0, m_now));
+    }
+
+    //--------------------------------------------------------------------------
+    void Link(std::uint32_t index)
+    {
+        auto &node = m_nodes[index];
+
+        //----------------------------------------------------------------------
+        // Past deadlines go to the current slot of level 0.
+        auto deadline = (node.deadline > m_now) ? node.deadline : m_now;
+        auto diff     = deadline ^ m_now;
+        auto level    = (diff == 0) ? 0 : (63 - __builtin_clzll(diff)) / k_slot_bits;
+        auto slot     = std::uint32_t(level * k_slot_count + SlotOf(level, deadline));
+
+        node.slot = slot;
+        node.prev = k_null;
+        node.next = m_heads[slot];
+
+        if(node.next != k_null)
+            m_nodes[node.next].prev = index;
+
+        m_heads  [slot ] = index;
+        m_bitmaps[level] |= std::uint64_t(1) << (slot % k_slot_count);
+    }
+
+    void Unlink(std::uint32_t index)
+    {
+        auto &node = m_nodes[index];
+
+        if(node.prev != k_null)
+            m_nodes[node.prev].next = node.next;
+        else
+            m_heads[node.slot] = node.next;
+
+        if(node.next != k_null)
+            m_nodes[node.next].prev = node.prev;
+
+        if(m_heads[node.slot] == k_null)
+        {
+            m_bitmaps[node.slot / k_slot_count] &=
+                ~(std::uint64_t(1) << (node.slot % k_slot_count));
+        }
+
+        node.slot = k_null;
+    }
+
+    //--------------------------------------------------------------------------
+    std::uint32_t AllocateNode()
+    {
+        if(m_freeList != k_null)
+        {
+            auto index = m_freeList;
+            m_freeList = m_nodes[index].next;
+
+            return index;
+        }
+
+        m_nodes.push_back(Node{ 0, k_null, k_null, 0, k_null, TPayload() });
+        return std::uint32_t(m_nodes.size() - 1);
+    }
+
+    void FreeNode(std::uint32_t index)
+    {
+        auto &node = m_nodes[index];
+
+        node.payload = TPayload();
+        node.slot    = k_null;
+        node.next    = m_freeList;
+        ++node.generation;
+
+        m_freeList = index;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    time_t        m_originTicks;
+    time_t        m_resolutionTicks;
+    std::uint64_t m_now;            // Units since the start.
+    size_t        m_count;
+    std::uint32_t m_freeList;       // Index of the first free node.
+
+    std::uint32_t              m_heads  [k_levels * k_slot_count];
+    std::uint64_t              m_bitmaps[k_levels];
+    std::vector<Node>          m_nodes;
+    std::vector<std::uint32_t> m_expired;
+};
+
+NS_CORETIME_END
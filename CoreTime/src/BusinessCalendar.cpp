@@ -0,0 +1,242 @@
+// Header
+#include "../include/BusinessCalendar.h"
+// std
+#include <algorithm>
+#include <stdexcept>
+// CoreTime
+#include "../include/CivilCalendar.h"
+#include "../include/TimeSpan.h"
+#include "../include/TimeZone.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+time_t to_wall_ticks(const DateTime &dateTime)
+{
+    return dateTime.ToLocalTimePoint().time_since_epoch().count();
+}
+
+//------------------------------------------------------------------------------
+DateTime from_wall_ticks(time_t wallTicks, DateTime::DateTimeKind kind)
+{
+    if(kind != DateTime::DateTimeKind::Local)
+        return DateTime(wallTicks, kind);
+
+    //--------------------------------------------------------------------------
+    // Local DateTimes hold UTC ticks.
+    return DateTime(TimeZone::Local().ToUtcTicks(wallTicks), kind);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+BusinessCalendar::BusinessCalendar(
+    time_t       firstYear,
+    time_t       lastYear,
+    std::uint8_t weekendDays /* = SaturdayAndSunday */) :
+    m_firstDay(CivilCalendar::DaysFromCivil(firstYear, 1, 1)),
+    m_dayCount(0),
+    m_bits    (),
+    m_counts  ()
+{
+    if(lastYear < firstYear)
+        throw std::invalid_argument("BusinessCalendar - lastYear is before firstYear");
+
+    m_dayCount = size_t(CivilCalendar::DaysFromCivil(lastYear + 1, 1, 1) - m_firstDay);
+    m_bits.assign((m_dayCount + 63) / 64, 0);
+
+    //--------------------------------------------------------------------------
+    // 1970-01-01 was a Thursday.
+    auto day_of_week = CivilCalendar::FloorMod(m_firstDay + 4, 7);
+    for(size_t day = 0; day < m_dayCount; ++day)
+    {
+        if(((weekendDays >> day_of_week) & 1) == 0)
+            m_bits[day / 64] |= std::uint64_t(1) << (day % 64);
+
+        day_of_week = (day_of_week == 6) ? 0 : day_of_week + 1;
+    }
+
+    BuildCounts();
+}
+
+
+//----------------------------------------------------------------------------//
+// Getters                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool BusinessCalendar::IsBusinessDay(const DateTime &dateTime) const
+{
+    auto day = DayIndex(to_wall_ticks(dateTime));
+    return (m_bits[day / 64] >> (day % 64)) & 1;
+}
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void BusinessCalendar::AddHolidays(std::span<const DateTime> dateTimes)
+{
+    for(const auto &dateTime : dateTimes)
+    {
+        auto day = DayIndex(to_wall_ticks(dateTime));
+        m_bits[day / 64] &= ~(std::uint64_t(1) << (day % 64));
+    }
+
+    BuildCounts();
+}
+
+//------------------------------------------------------------------------------
+DateTime BusinessCalendar::AddBusinessDays(const DateTime &dateTime, time_t count) const
+{
+    return from_wall_ticks(
+        AddBusinessDaysToWallTicks(to_wall_ticks(dateTime), count),
+        dateTime.Kind()
+    );
+}
+
+//------------------------------------------------------------------------------
+time_t BusinessCalendar::BusinessDaysBetween(const DateTime &from, const DateTime &to) const
+{
+    return time_t(Rank(DayIndex(to_wall_ticks(to))))
+         - time_t(Rank(DayIndex(to_wall_ticks(from))));
+}
+
+//------------------------------------------------------------------------------
+DateTime BusinessCalendar::NextBusinessDay(const DateTime &dateTime) const
+{
+    //--------------------------------------------------------------------------
+    // From a business day adding 1 already moves to the next one, from
+    // any other day it stops at the first one after it.
+    return AddBusinessDays(dateTime, 1);
+}
+
+//------------------------------------------------------------------------------
+DateTime BusinessCalendar::PreviousBusinessDay(const DateTime &dateTime) const
+{
+    return AddBusinessDays(dateTime, -1);
+}
+
+//------------------------------------------------------------------------------
+void BusinessCalendar::AddBusinessDays(
+    std::span<const time_t> ticks,
+    time_t                  count,
+    std::span<time_t>       result) const
+{
+    if(result.size() != ticks.size())
+        throw std::invalid_argument("BusinessCalendar - Sizes don't match");
+
+    for(size_t i = 0; i < ticks.size(); ++i)
+        result[i] = AddBusinessDaysToWallTicks(ticks[i], count);
+}
+
+//------------------------------------------------------------------------------
+void BusinessCalendar::BusinessDaysBetween(
+    std::span<const time_t> from,
+    std::span<const time_t> to,
+    std::span<time_t>       result) const
+{
+    if(to.size() != from.size() || result.size() != from.size())
+        throw std::invalid_argument("BusinessCalendar - Sizes don't match");
+
+    for(size_t i = 0; i < from.size(); ++i)
+        result[i] = time_t(Rank(DayIndex(to[i]))) - time_t(Rank(DayIndex(from[i])));
+}
+
+
+//----------------------------------------------------------------------------//
+// Helper Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+size_t BusinessCalendar::DayIndex(time_t wallTicks) const
+{
+    auto day = CivilCalendar::FloorDiv(wallTicks, TimeSpan::TicksPerDay) - m_firstDay;
+    if(day < 0 || size_t(day) >= m_dayCount)
+        throw std::out_of_range("BusinessCalendar - Date out of the calendar years");
+
+    return size_t(day);
+}
+
+//------------------------------------------------------------------------------
+size_t BusinessCalendar::Rank(size_t dayIndex) const
+{
+    auto below = (std::uint64_t(1) << (dayIndex % 64)) - 1;
+    return m_counts[dayIndex / 64] + __builtin_popcountll(m_bits[dayIndex / 64] & below);
+}
+
+//------------------------------------------------------------------------------
+size_t BusinessCalendar::Select(size_t rank, size_t hintDay) const
+{
+    if(rank >= m_counts.back())
+        throw std::out_of_range("BusinessCalendar - Date out of the calendar years");
+
+    //--------------------------------------------------------------------------
+    // Find the word holding the rank - The last one whose count isn't past
+    // it. Most moves are of a few days, so look around the word of the
+    // starting day before searching everything.
+    auto word  = hintDay / 64;
+    auto found = false;
+    for(int step = 0; step < 4 && !found; ++step)
+    {
+        if(m_counts[word] > rank)
+            --word;
+        else if(m_counts[word + 1] <= rank)
+            ++word;
+        else
+            found = true;
+    }
+
+    if(!found)
+    {
+        auto it = std::upper_bound(m_counts.begin(), m_counts.end(), std::uint32_t(rank));
+        word    = size_t(it - m_counts.begin()) - 1;
+    }
+
+    auto bits = m_bits[word];
+    for(auto skip = rank - m_counts[word]; skip > 0; --skip)
+        bits &= bits - 1;
+
+    return word * 64 + size_t(__builtin_ctzll(bits));
+}
+
+//------------------------------------------------------------------------------
+time_t BusinessCalendar::AddBusinessDaysToWallTicks(time_t wallTicks, time_t count) const
+{
+    if(count == 0)
+        return wallTicks;
+
+    //--------------------------------------------------------------------------
+    // Forward - The count-th business day after the ones up to the day.
+    // Backwards - The count-th business day before the ones before it.
+    auto day  = DayIndex(wallTicks);
+    auto rank = time_t(Rank(day));
+    if(count > 0)
+        rank += ((m_bits[day / 64] >> (day % 64)) & 1) + count - 1;
+    else
+        rank += count;
+
+    if(rank < 0)
+        throw std::out_of_range("BusinessCalendar - Date out of the calendar years");
+
+    return wallTicks + (time_t(Select(size_t(rank), day)) - time_t(day)) * TimeSpan::TicksPerDay;
+}
+
+//------------------------------------------------------------------------------
+void BusinessCalendar::BuildCounts()
+{
+    m_counts.resize(m_bits.size() + 1);
+    m_counts[0] = 0;
+
+    for(size_t i = 0; i < m_bits.size(); ++i)
+        m_counts[i + 1] = m_counts[i] + std::uint32_t(__builtin_popcountll(m_bits[i]));
+}
@@ -0,0 +1,239 @@
+// Header
+#include "../include/ClockSource.h"
+// std
+#include <atomic>
+#if defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+#endif
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// The Tsc calibration shared by every thread, behind a sequence lock: The
+// sequence is odd while it is written, and readers retry when it was odd
+// or changed while they read. Only one thread writes at a time - The first
+// calibration runs once and the resynchronizations take isResyncing.
+struct TscState
+{
+    std::atomic<std::uint32_t> sequence;
+    std::atomic<std::uint64_t> baseCounter;
+    std::atomic<time_t>        baseTicks;
+    std::atomic<std::uint64_t> multiplier;
+    std::atomic<std::uint64_t> resyncCounter; // Counter of the next resync.
+    std::atomic_flag           isResyncing;
+};
+
+//------------------------------------------------------------------------------
+// Constant initialized - No guard on each access.
+TscState& tsc_state()
+{
+    static TscState s_state;
+    return s_state;
+}
+
+//------------------------------------------------------------------------------
+bool has_invariant_tsc()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    //--------------------------------------------------------------------------
+    // Reference:
+    //   Intel SDM Vol. 3B 17.17.1 - Invariant TSC.
+    //   CPUID.80000007H:EDX[8]
+    unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if(!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx))
+        return false;
+
+    return (edx & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Reads the counter and the realtime clock as close together as possible.
+// The counter is read around the clock and the tightest of a few tries is
+// kept, with the counter taken at the middle of it.
+void sample_tsc(std::uint64_t &counter, time_t &ticks)
+{
+    auto best_window = ~std::uint64_t(0);
+    for(int i = 0; i < 8; ++i)
+    {
+        auto before = ClockSource::Tsc::ReadCounter();
+        auto now    = ClockSource::Realtime::UtcTicks();
+        auto after  = ClockSource::Tsc::ReadCounter();
+
+        if(after - before >= best_window)
+            continue;
+
+        best_window = (after - before);
+        counter     = before + best_window / 2;
+        ticks       = now;
+    }
+}
+
+//------------------------------------------------------------------------------
+// Ticks per counter in 32.32 fixed point between two samples - 0 when the
+// wall clock didn't go forward between them.
+std::uint64_t measure_multiplier(
+    std::uint64_t startCounter,
+    time_t        startTicks,
+    std::uint64_t endCounter,
+    time_t        endTicks)
+{
+    auto elapsed_counter = std::int64_t(endCounter - startCounter);
+    auto elapsed_ticks   = (endTicks - startTicks);
+    if(elapsed_counter <= 0 || elapsed_ticks <= 0)
+        return 0;
+
+    return std::uint64_t(
+        double(elapsed_ticks) / double(elapsed_counter) * 4294967296.0
+    );
+}
+
+//------------------------------------------------------------------------------
+ClockSource::Tsc::Calibration read_calibration(const TscState &state)
+{
+    auto calibration = ClockSource::Tsc::Calibration{true, 0, 0, 0};
+    while(true)
+    {
+        auto before = state.sequence.load(std::memory_order_acquire);
+
+        calibration.baseCounter = state.baseCounter.load(std::memory_order_relaxed);
+        calibration.baseTicks   = state.baseTicks  .load(std::memory_order_relaxed);
+        calibration.multiplier  = state.multiplier .load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        auto after = state.sequence.load(std::memory_order_relaxed);
+
+        if(before == after && (before & 1) == 0)
+            return calibration;
+    }
+}
+
+//------------------------------------------------------------------------------
+void write_calibration(
+    TscState      &state,
+    std::uint64_t  baseCounter,
+    time_t         baseTicks,
+    std::uint64_t  multiplier)
+{
+    auto interval_counter = std::uint64_t(
+        double(ClockSource::Tsc::ResyncIntervalTicks) * 4294967296.0 / double(multiplier)
+    );
+
+    auto sequence = state.sequence.load(std::memory_order_relaxed);
+    state.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    state.baseCounter  .store(baseCounter,                    std::memory_order_relaxed);
+    state.baseTicks    .store(baseTicks,                      std::memory_order_relaxed);
+    state.multiplier   .store(multiplier,                     std::memory_order_relaxed);
+    state.resyncCounter.store(baseCounter + interval_counter, std::memory_order_relaxed);
+
+    state.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+//------------------------------------------------------------------------------
+// Measures how many ticks the counter advances in ~10ms.
+bool calibrate_tsc()
+{
+    if(!has_invariant_tsc())
+        return false;
+
+    std::uint64_t start_counter = 0, end_counter = 0;
+    time_t        start_ticks   = 0, end_ticks   = 0;
+
+    sample_tsc(start_counter, start_ticks);
+
+    struct timespec _timespec = {0, 10 * 1000 * 1000};
+    nanosleep(&_timespec, nullptr);
+
+    sample_tsc(end_counter, end_ticks);
+
+    auto multiplier = measure_multiplier(start_counter, start_ticks, end_counter, end_ticks);
+    if(multiplier == 0)
+        return false;
+
+    write_calibration(tsc_state(), end_counter, end_ticks, multiplier);
+    return true;
+}
+
+//------------------------------------------------------------------------------
+// Snaps the calibration to the realtime clock and takes the rate of the
+// counter over the last interval - Unless the wall clock was stepped in
+// it (off by more than 0.1%), which says nothing about the rate.
+void resync_tsc()
+{
+    auto &state = tsc_state();
+    if(state.isResyncing.test_and_set(std::memory_order_acquire))
+        return; // Another thread is at it - Keep the current calibration.
+
+    auto calibration = read_calibration(state);
+
+    std::uint64_t counter = 0;
+    time_t        ticks   = 0;
+    sample_tsc(counter, ticks);
+
+    auto multiplier = calibration.multiplier;
+    auto measured   = measure_multiplier(
+        calibration.baseCounter, calibration.baseTicks, counter, ticks
+    );
+
+    if(measured > multiplier - multiplier / 1000
+    && measured < multiplier + multiplier / 1000)
+    {
+        multiplier = measured;
+    }
+
+    write_calibration(state, counter, ticks, multiplier);
+    state.isResyncing.clear(std::memory_order_release);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Clocks                                                                     //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool ClockSource::Tsc::WarmUp()
+{
+    static const bool s_isReliable = []() {
+        auto is_reliable = calibrate_tsc();
+        s_isCalibrated.store(is_reliable, std::memory_order_relaxed);
+
+        return is_reliable;
+    }();
+    return s_isReliable;
+}
+
+//------------------------------------------------------------------------------
+ClockSource::Tsc::Calibration ClockSource::Tsc::GetCalibration()
+{
+    if(!WarmUp())
+        return Calibration{false, 0, 0, 0};
+
+    return read_calibration(tsc_state());
+}
+
+//------------------------------------------------------------------------------
+time_t ClockSource::Tsc::UtcTicks()
+{
+    if(!WarmUp())
+        return Realtime::UtcTicks();
+
+    auto counter = ReadCounter();
+    if(std::int64_t(counter - tsc_state().resyncCounter.load(std::memory_order_relaxed)) >= 0)
+    {
+        resync_tsc();
+        counter = ReadCounter();
+    }
+
+    return CounterToTicks(counter);
+}
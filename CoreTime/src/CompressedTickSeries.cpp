@@ -0,0 +1,270 @@
+// Header
+#include "../include/CompressedTickSeries.h"
+// std
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Payload bits of the codes by their number of leading ones - 10, 110,
+// 1110, 11110 and 11111.
+constexpr int k_code_widths [] = { 8, 16, 24, 32, 64 };
+constexpr int k_code_lengths[] = { 2,  3,  4,  5,  5 };
+
+//------------------------------------------------------------------------------
+inline std::uint64_t zigzag(std::uint64_t value)
+{
+    return (value << 1) ^ std::uint64_t(std::int64_t(value) >> 63);
+}
+
+//------------------------------------------------------------------------------
+inline std::uint64_t unzigzag(std::uint64_t value)
+{
+    return (value >> 1) ^ (~(value & 1) + 1);
+}
+
+//------------------------------------------------------------------------------
+// Reads the bits MSB first, as written by CompressedTickSeries::WriteBits.
+// Reads past the end give zeros.
+struct BitReader
+{
+    const std::uint8_t *data;
+    size_t             size;
+    size_t             bitPos;
+
+    std::uint64_t LoadBigEndian(size_t offset) const
+    {
+        if(offset + 8 <= size)
+        {
+            std::uint64_t value;
+            std::memcpy(&value, data + offset, sizeof(value));
+            return __builtin_bswap64(value);
+        }
+
+        std::uint64_t value = 0;
+        for(size_t i = 0; i < 8; ++i)
+            value = (value << 8) | ((offset + i < size) ? data[offset + i] : 0);
+
+        return value;
+    }
+
+    std::uint64_t Peek() const
+    {
+        auto offset = bitPos >> 3;
+        auto shift  = int(bitPos & 7);
+        auto value  = LoadBigEndian(offset);
+
+        if(shift == 0)
+            return value;
+
+        auto next = (offset + 8 < size) ? data[offset + 8] : 0;
+        return (value << shift) | (std::uint64_t(next) >> (8 - shift));
+    }
+
+    std::uint64_t Read(int count)
+    {
+        auto value = Peek() >> (64 - count);
+        bitPos += count;
+
+        return value;
+    }
+};
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+CompressedTickSeries::CompressedTickSeries(size_t checkpointInterval /* = 1024 */) :
+    m_checkpointInterval(std::max<size_t>(checkpointInterval, 1)),
+    m_count             (0),
+    m_prevTicks         (0),
+    m_prevDelta         (0),
+    m_freeBits          (0),
+    m_bytes             (),
+    m_checkpoints       ()
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void CompressedTickSeries::Append(time_t ticks)
+{
+    auto value = std::uint64_t(ticks);
+
+    //--------------------------------------------------------------------------
+    // Checkpoint - Byte aligned and with the ticks in full (little endian).
+    if(m_count % m_checkpointInterval == 0)
+    {
+        m_checkpoints.push_back(m_bytes.size());
+        for(int i = 0; i < 8; ++i)
+            m_bytes.push_back(std::uint8_t(value >> (i * 8)));
+
+        m_freeBits  = 0;
+        m_prevTicks = value;
+        m_prevDelta = 0;
+        ++m_count;
+
+        return;
+    }
+
+    auto delta = value - m_prevTicks;
+    auto code  = zigzag(delta - m_prevDelta);
+
+    if(code == 0)
+        WriteBits(0, 1);
+    else if(code < (std::uint64_t(1) <<  8))
+        WriteBits((std::uint64_t(0b10)    <<  8) | code, 2 +  8);
+    else if(code < (std::uint64_t(1) << 16))
+        WriteBits((std::uint64_t(0b110)   << 16) | code, 3 + 16);
+    else if(code < (std::uint64_t(1) << 24))
+        WriteBits((std::uint64_t(0b1110)  << 24) | code, 4 + 24);
+    else if(code < (std::uint64_t(1) << 32))
+        WriteBits((std::uint64_t(0b11110) << 32) | code, 5 + 32);
+    else
+    {
+        WriteBits(0b11111, 5);
+        WriteBits(code,   64);
+    }
+
+    m_prevTicks = value;
+    m_prevDelta = delta;
+    ++m_count;
+}
+
+//------------------------------------------------------------------------------
+time_t CompressedTickSeries::At(size_t index) const
+{
+    if(index >= m_count)
+        throw std::out_of_range("CompressedTickSeries - Index out of range");
+
+    auto ticks = time_t(0);
+    DecodeBlock(
+        index / m_checkpointInterval,
+        index % m_checkpointInterval,
+        1,
+        &ticks
+    );
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+void CompressedTickSeries::Decode(size_t first, std::span<time_t> ticks) const
+{
+    if(first > m_count || ticks.size() > m_count - first)
+        throw std::out_of_range("CompressedTickSeries - Range out of range");
+
+    auto out = ticks.data();
+    auto end = first + ticks.size();
+
+    while(first < end)
+    {
+        auto block = first / m_checkpointInterval;
+        auto skip  = first % m_checkpointInterval;
+        auto count = std::min(m_checkpointInterval - skip, end - first);
+
+        DecodeBlock(block, skip, count, out);
+
+        out   += count;
+        first += count;
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Helper Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void CompressedTickSeries::WriteBits(std::uint64_t value, int count)
+{
+    while(count > 0)
+    {
+        if(m_freeBits == 0)
+        {
+            m_bytes.push_back(0);
+            m_freeBits = 8;
+        }
+
+        auto take = std::min(count, m_freeBits);
+        auto bits = (value >> (count - take)) & ((1u << take) - 1);
+
+        m_bytes.back() |= std::uint8_t(bits << (m_freeBits - take));
+        m_freeBits     -= take;
+        count          -= take;
+    }
+}
+
+//------------------------------------------------------------------------------
+void CompressedTickSeries::DecodeBlock(
+    size_t block,
+    size_t skip,
+    size_t count,
+    time_t *ticks) const
+{
+    auto offset = m_checkpoints[block];
+    auto value  = std::uint64_t(0);
+    for(int i = 0; i < 8; ++i)
+        value |= std::uint64_t(m_bytes[offset + i]) << (i * 8);
+
+    auto reader = BitReader{ m_bytes.data(), m_bytes.size(), (offset + 8) * 8 };
+    auto delta  = std::uint64_t(0);
+    auto end    = skip + count;
+
+    if(skip == 0)
+        ticks[0] = time_t(value);
+
+    //--------------------------------------------------------------------------
+    // index is the position of the next value in the block.
+    auto index = size_t(1);
+    while(index < end)
+    {
+        auto window = reader.Peek();
+
+        //----------------------------------------------------------------------
+        // A run of 0 codes - The same delta over and over. Fill them at
+        // once with an arithmetic sequence (which vectorizes).
+        if((window >> 63) == 0)
+        {
+            auto run = std::min<size_t>(std::countl_zero(window), end - index);
+
+            auto from = (index < skip) ? (skip - index) : 0;
+            for(auto i = from; i < run; ++i)
+                ticks[index + i - skip] = time_t(value + (i + 1) * delta);
+
+            value         += run * delta;
+            index         += run;
+            reader.bitPos += run;
+            continue;
+        }
+
+        //----------------------------------------------------------------------
+        // The window is all ones when a 11111 code is followed by a payload
+        // that starts with ones - countl_one is defined there (64).
+        auto ones = std::min(std::countl_one(window), 5);
+        reader.bitPos += k_code_lengths[ones - 1];
+
+        delta += unzigzag(reader.Read(k_code_widths[ones - 1]));
+        value += delta;
+
+        if(index >= skip)
+            ticks[index - skip] = time_t(value);
+
+        ++index;
+    }
+}
@@ -1,8 +1,14 @@
 // Header
 #include "../include/DateTime.h"
 // CoreTime
+#include "../include/CivilCalendar.h"
 #include "../include/TimeSpan.h"
-#include <sys/time.h>
+#include "../include/TimeZone.h"
+// std
+#include <stdexcept>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
 // Usings
 USING_NS_CORETIME;
 
@@ -10,178 +16,114 @@ USING_NS_CORETIME;
 //----------------------------------------------------------------------------//
 // Helper Functions                                                           //
 //----------------------------------------------------------------------------//
-DateTime::tm_t convert_to_tm(time_t ticks, DateTime::DateTimeKind kind)
-{
-    auto seconds = (ticks / TimeSpan::TicksPerSecond);
-
-    DateTime::tm_t _tm = {0};
-    (kind == DateTime::DateTimeKind::UTC)
-        ? gmtime_r   (&seconds, &_tm)
-        : localtime_r(&seconds, &_tm);
-
-    return _tm;
-}
-
+namespace {
 
-//----------------------------------------------------------------------------//
-// CTOR / DTOR                                                                //
-//----------------------------------------------------------------------------//
 //------------------------------------------------------------------------------
-DateTime::DateTime(
-    time_t       year,
-    time_t       month,
-    time_t       day,
-    time_t       hour,
-    time_t       minute,
-    time_t       second,
-    time_t       millisecond,
-    DateTimeKind kind /* = DateTimeKind::UTC */) :
-    m_kind               (kind),
-    m_tmIsDirty          (true)
+inline bool is_digit(char c)
 {
-    auto tm = tm_t{
-        .tm_sec   = second,      /* Seconds. [0-60] (1 leap second) */
-        .tm_min   = minute,      /* Minutes. [0-59]                 */
-        .tm_hour  = hour,        /* Hours.   [0-23]                 */
-        .tm_mday  = day,         /* Day.     [1-31]                 */
-        .tm_mon   = month - 1,   /* Month.   [0-11]                 */
-        .tm_year  = year - 1900, /* Year - 1900.                    */
-        .tm_wday  = 0,           /* Day of week. [0-6]              */
-        .tm_yday  = 0,           /* Days in year.[0-365]            */
-        .tm_isdst =  -1          /* DST.     [-1/0/1]               */
-    };
-
-    auto seconds          = mktime(&tm);
-    m_ticksSinceUnixEpoch = (seconds * TimeSpan::TicksPerSecond);
+    return std::uint8_t(c - '0') <= 9;
 }
 
 //------------------------------------------------------------------------------
-DateTime::DateTime(
-    time_t       ticks,
-    DateTimeKind kind /* = DateTimeKind::UTC */) :
-    m_ticksSinceUnixEpoch(ticks),
-    m_kind               ( kind),
-    m_tmIsDirty          ( true)
+inline bool parse_2_digits(const char *p, std::int32_t &value)
 {
-    // Empty...
-}
-
+    if(!is_digit(p[0]) || !is_digit(p[1]))
+        return false;
 
-//----------------------------------------------------------------------------//
-// Getters                                                                    //
-//----------------------------------------------------------------------------//
-//------------------------------------------------------------------------------
-time_t DateTime::Day() const
-{
-    return Update_tm().tm_mday;
+    value = (p[0] - '0') * 10 + (p[1] - '0');
+    return true;
 }
 
 //------------------------------------------------------------------------------
-time_t DateTime::DayOfWeek() const
+// YYYY-MM-DD
+bool parse_date(const char *p, std::int32_t fields[5])
 {
-    return Update_tm().tm_wday;
+    std::int32_t century = 0, year = 0;
+    return parse_2_digits(p + 0, century)
+        && parse_2_digits(p + 2, year     ) && p[4] == '-'
+        && parse_2_digits(p + 5, fields[1]) && p[7] == '-'
+        && parse_2_digits(p + 8, fields[2])
+        && ((fields[0] = century * 100 + year), true);
 }
 
 //------------------------------------------------------------------------------
-time_t DateTime::DayOfYear() const
+// (T|t| )hh:mm after the date.
+bool parse_hour_minute(const char *p, std::int32_t fields[5])
 {
-    return Update_tm().tm_yday + 1;
+    return (p[10] == 'T' || p[10] == 't' || p[10] == ' ')
+        && parse_2_digits(p + 11, fields[3]) && p[13] == ':'
+        && parse_2_digits(p + 14, fields[4]);
 }
 
 //------------------------------------------------------------------------------
-time_t DateTime::Hour() const
+// YYYY-MM-DD(T|t| )hh:mm - Needs 16 readable bytes.
+// Validates all the 16 bytes at once with SSE2 when available.
+bool parse_date_hour_minute(const char *p, std::int32_t fields[5])
 {
-    return Update_tm().tm_hour;
-}
+#if defined(__SSE2__)
+    //--------------------------------------------------------------------------
+    // Digits are the bytes that are <= 9 after subtracting '0'.
+    constexpr int k_digits_mask     = 0b1101101101101111;
+    constexpr int k_separators_mask = 0b0010000010010000;
 
-//------------------------------------------------------------------------------
-DateTime::DateTimeKind DateTime::Kind() const
-{
-    return m_kind;
-}
+    auto bytes  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    auto digits = _mm_sub_epi8(bytes, _mm_set1_epi8('0'));
+    auto nines  = _mm_set1_epi8(9);
 
-//------------------------------------------------------------------------------
-time_t DateTime::Millisecond() const
-{
-    return 0;
-}
+    auto is_digit_mask = _mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_min_epu8(digits, nines), digits)
+    );
+    auto is_separator_mask = _mm_movemask_epi8(
+        _mm_cmpeq_epi8(
+            bytes,
+            _mm_setr_epi8(0, 0, 0, 0, '-', 0, 0, '-', 0, 0, 0, 0, 0, ':', 0, 0)
+        )
+    );
 
-//------------------------------------------------------------------------------
-time_t DateTime::Minute() const
-{
-    return Update_tm().tm_min;
-}
+    if((is_digit_mask     & k_digits_mask    ) != k_digits_mask
+    || (is_separator_mask & k_separators_mask) != k_separators_mask
+    || !(p[10] == 'T' || p[10] == 't' || p[10] == ' '))
+    {
+        return false;
+    }
 
-//------------------------------------------------------------------------------
-time_t DateTime::Month() const
-{
-    return Update_tm().tm_mon + 1;
-}
+    alignas(16) std::uint8_t d[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(d), digits);
 
-//------------------------------------------------------------------------------
-DateTime DateTime::Now()
-{
-    //--------------------------------------------------------------------------
-    // Get the "time" since the epoch.
-    struct timeval _timeval = {0};
-    gettimeofday(&_timeval, nullptr);
+    fields[0] = d[0] * 1000 + d[1] * 100 + d[2] * 10 + d[3];
+    fields[1] = d[ 5] * 10 + d[ 6];
+    fields[2] = d[ 8] * 10 + d[ 9];
+    fields[3] = d[11] * 10 + d[12];
+    fields[4] = d[14] * 10 + d[15];
 
-    //--------------------------------------------------------------------------
-    // Now we have the "time" in the localtime, just calculate
-    // how many ticks this represents.
-    return DateTime(
-        _timeval.tv_sec         * TimeSpan::TicksPerSecond +
-        _timeval.tv_usec / 1000 * TimeSpan::TicksPerMillisecond,
-        DateTimeKind::Local
-    );
+    return true;
+#else
+    return parse_date(p, fields) && parse_hour_minute(p, fields);
+#endif
 }
 
-//------------------------------------------------------------------------------
-time_t DateTime::Second() const
-{
-    return Update_tm().tm_sec;
-}
+} // namespace
 
-//------------------------------------------------------------------------------
-time_t DateTime::Ticks() const
-{
-    return m_ticksSinceUnixEpoch;
-}
 
+//----------------------------------------------------------------------------//
+// Getters                                                                    //
+//----------------------------------------------------------------------------//
 //------------------------------------------------------------------------------
-TimeSpan DateTime::TimeOfDay() const
+DateTime DateTime::Now()
 {
-    return TimeSpan(m_ticksSinceUnixEpoch);
+    return Now<ClockSource::Realtime>();
 }
 
 //------------------------------------------------------------------------------
 DateTime DateTime::Today()
 {
-    //COWTODO(n2omatt): Implement...
+    return Now().Floor(DateTimeUnit::Day);
 }
 
 //------------------------------------------------------------------------------
 DateTime DateTime::UtcNow()
 {
-    // Get the "time" since the epoch.
-    struct timeval _timeval = {0};
-    gettimeofday(&_timeval, nullptr);
-
-    //--------------------------------------------------------------------------
-    // Now we have the "time" in the localtime, just calculate
-    // how many ticks this represents.
-    return DateTime(
-        _timeval.tv_sec         * TimeSpan::TicksPerSecond +
-        _timeval.tv_usec / 1000 * TimeSpan::TicksPerMillisecond,
-        DateTimeKind::UTC
-    );
-}
-
-
-//------------------------------------------------------------------------------
-time_t DateTime::Year() const
-{
-    return Update_tm().tm_year + 1900;
+    return UtcNow<ClockSource::Realtime>();
 }
 
 
@@ -189,213 +131,176 @@ time_t DateTime::Year() const
 // Methods                                                                    //
 //----------------------------------------------------------------------------//
 //------------------------------------------------------------------------------
-DateTime DateTime::Add(const TimeSpan &timeSpan)
+bool DateTime::IsDaylightSavingTime() const
 {
+    if(UnpackKind() != DateTimeKind::Local)
+        return false;
 
+    return TimeZone::Local().GetPeriod(UnpackTicks()).isDst;
 }
 
 //------------------------------------------------------------------------------
-DateTime DateTime::AddDays(double days)
-{
-    return DateTime(
-        m_ticksSinceUnixEpoch + (days * TimeSpan::TicksPerDay),
-        m_kind
-    );
-}
-
-//------------------------------------------------------------------------------
-DateTime DateTime::AddHours(double hours)
-{
-    return DateTime(
-        m_ticksSinceUnixEpoch + (hours * TimeSpan::TicksPerHour),
-        m_kind
-    );
-}
-
-//------------------------------------------------------------------------------
-DateTime DateTime::AddMilliseconds(double ms)
+DateTime DateTime::Parse(const std::string &format)
 {
-    return DateTime(
-        m_ticksSinceUnixEpoch + (ms * TimeSpan::TicksPerMillisecond),
-        m_kind
-    );
-}
+    auto result = DateTime(0);
+    if(!TryParse(format, result))
+        throw std::invalid_argument("Invalid ISO-8601 date time: " + format);
 
-//------------------------------------------------------------------------------
-DateTime DateTime::AddMinutes(double minutes)
-{
-    return DateTime(
-        m_ticksSinceUnixEpoch + (minutes * TimeSpan::TicksPerMinute),
-        m_kind
-    );
+    return result;
 }
 
 //------------------------------------------------------------------------------
-DateTime DateTime::AddMonths(time_t months)
+bool DateTime::TryParse(std::string_view str, DateTime &result)
 {
-    //--------------------------------------------------------------------------
-    // Get the current date.
-    auto curr_day   = Day  ();
-    auto curr_month = Month();
-    auto curr_year  = Year ();
+    auto p = str.data();
+    auto n = str.size();
 
     //--------------------------------------------------------------------------
-    // Calculate which month/year we gonna be.
-    auto target_month = (curr_month + months) % 12;
-    auto span_years   = (curr_month + months) / 12;
+    // Date and (maybe) hours and minutes.
+    std::int32_t fields[5] = {0};
+    auto has_time = (n >= 16 && parse_date_hour_minute(p, fields));
+    auto i        = size_t(16);
 
-    if(target_month == 0)
+    if(!has_time)
     {
-        target_month = curr_month;
-        --span_years;
-    }
-
-    auto target_year = curr_year + span_years;
-
-    //--------------------------------------------------------------------------
-    // Clamp the day, so it'll be valid on that month.
-    auto days_in_target_month = DaysInMonth(target_month, target_year);
-    auto target_day           = curr_day;
-    if(curr_day > days_in_target_month)
-        target_day = days_in_target_month;
-
-
-    return DateTime(
-        target_year,
-        target_month,
-        target_day,
-        Hour       (),
-        Minute     (),
-        Second     (),
-        Millisecond(),
-        m_kind
-    );
-}
-
-//------------------------------------------------------------------------------
-DateTime DateTime::AddSeconds(double seconds)
-{
-    return DateTime(
-        m_ticksSinceUnixEpoch + (seconds * TimeSpan::TicksPerSecond),
-        m_kind
-    );
-}
-
-//------------------------------------------------------------------------------
-DateTime DateTime::AddTicks(time_t ticks)
-{
-
-}
+        if(n < 10 || !parse_date(p, fields))
+            return false;
 
-//------------------------------------------------------------------------------
-DateTime DateTime::AddYears(time_t years)
-{
-    return AddMonths(years * 12);
-}
+        has_time = (n > 10);
+        if(has_time && !(n >= 16 && parse_hour_minute(p, fields)))
+            return false;
 
-//------------------------------------------------------------------------------
-time_t DateTime::Compare(const DateTime &lhs, const DateTime &rhs)
-{
-
-}
-
-//------------------------------------------------------------------------------
-time_t DateTime::CompareTo(const DateTime &rhs) const
-{
+        i = (has_time) ? 16 : 10;
+    }
 
-}
-
-//------------------------------------------------------------------------------
-time_t DateTime::DaysInMonth(time_t month, time_t year)
-{
-    //COWTODO(n2omatt): Sanity checks...
-    --month;
+    auto year   = fields[0], month  = fields[1], day = fields[2];
+    auto hour   = fields[3], minute = fields[4];
+    auto second = std::int32_t(0);
+    auto ticks  = time_t(0);
+    auto kind   = DateTimeKind::None;
 
     //--------------------------------------------------------------------------
-    // Reference:
-    //   http://memorize.com/days-in-each-month
-    static int k_month_days[] = {
-        31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31
-    };
+    // :ss[.fraction]
+    if(has_time)
+    {
+        if(i + 3 > n || p[i] != ':' || !parse_2_digits(p + i + 1, second))
+            return false;
+        i += 3;
+
+        if(i < n && (p[i] == '.' || p[i] == ','))
+        {
+            auto first = ++i;
+            auto scale = TimeSpan::TicksPerSecond;
+            for(; i < n && is_digit(p[i]); ++i)
+            {
+                //--------------------------------------------------------------
+                // Digits past the tick precision are validated but ignored.
+                scale /= 10;
+                ticks += (p[i] - '0') * scale;
+            }
+
+            if(i == first)
+                return false;
+        }
+
+        //----------------------------------------------------------------------
+        // Z / +hh:mm[:ss] / -hh:mm[:ss]
+        if(i < n && (p[i] == 'Z' || p[i] == 'z'))
+        {
+            kind = DateTimeKind::UTC;
+            ++i;
+        }
+        else if(i < n && (p[i] == '+' || p[i] == '-'))
+        {
+            auto offset_hours = std::int32_t(0), offset_minutes = std::int32_t(0);
+            if(i + 6 > n
+            || !parse_2_digits(p + i + 1, offset_hours)
+            || p[i + 3] != ':'
+            || !parse_2_digits(p + i + 4, offset_minutes)
+            || offset_hours > 23 || offset_minutes > 59)
+            {
+                return false;
+            }
+
+            //------------------------------------------------------------------
+            // Seconds aren't RFC 3339 but are what zones with LMT offsets
+            // (and DateTimeFormat) write.
+            auto offset_seconds = std::int32_t(0);
+            auto offset_size    = 6;
+            if(i + 6 < n && p[i + 6] == ':')
+            {
+                if(i + 9 > n
+                || !parse_2_digits(p + i + 7, offset_seconds)
+                || offset_seconds > 59)
+                {
+                    return false;
+                }
+                offset_size = 9;
+            }
+
+            auto offset = offset_hours   * TimeSpan::TicksPerHour
+                        + offset_minutes * TimeSpan::TicksPerMinute
+                        + offset_seconds * TimeSpan::TicksPerSecond;
+
+            ticks -= (p[i] == '+') ? offset : -offset;
+            kind   = DateTimeKind::UTC;
+            i     += offset_size;
+        }
+    }
 
     //--------------------------------------------------------------------------
-    // Only February can change its month days.
-    if(month != 2)
-        return k_month_days[month];
+    // Nothing is allowed after it and everything must be in range.
+    if(i != n
+    || month  < 1 || month  > 12
+    || day    < 1 || day    > CivilCalendar::DaysInMonth(month, year)
+    || hour   > 23
+    || minute > 59
+    || second > 60)
+    {
+        return false;
+    }
 
-    //--------------------------------------------------------------------------
-    // Add a leap day if year is leap year.
-    return k_month_days[2] + ((IsLeapYear(year)) ? 1 : 0);
-}
+    ticks += CivilCalendar::ComposeTicks(
+        year, month, day, hour, minute, (second == 60) ? 59 : second, 0
+    );
 
-//------------------------------------------------------------------------------
-bool DateTime::IsDaylightSavingTime() const
-{
-    if(m_kind == DateTimeKind::UTC)
+    if(ticks < MinTicks || ticks > MaxTicks)
         return false;
 
-    return (Update_tm().tm_isdst > 0);
+    result = DateTime(ticks, kind);
+    return true;
 }
 
 //------------------------------------------------------------------------------
-bool DateTime::IsLeapYear(time_t year)
+void DateTime::ToLocalTime()
 {
     //--------------------------------------------------------------------------
-    // Reference:
-    //   https://en.wikipedia.org/wiki/Leap_year
-    return (year % 4 == 0) && (year % 100 == 0 && year % 400 != 0);
-}
-
-//------------------------------------------------------------------------------
-DateTime DateTime::Parse(const std::string &format)
-{
+    // Local DateTimes hold UTC ticks, so it is only a matter of relabeling
+    // them. DateTimes of DateTimeKind::None are taken as UTC.
+    m_ticksAndKind = Pack(UnpackTicks(), DateTimeKind::Local);
 }
 
 //------------------------------------------------------------------------------
-DateTime DateTime::SpecifyKind(const DateTime &dateTime, DateTimeKind kind)
-{
-
-}
-
-//------------------------------------------------------------------------------
-DateTime DateTime::Subtract(const DateTime &dateTime) const
+void DateTime::ToUniversalTime()
 {
-
+    //--------------------------------------------------------------------------
+    // Local DateTimes already hold UTC ticks and the ones of
+    // DateTimeKind::None are taken as UTC - Only a matter of relabeling.
+    m_ticksAndKind = Pack(UnpackTicks(), DateTimeKind::UTC);
 }
 
-//------------------------------------------------------------------------------
-DateTime DateTime::Subtract(const TimeSpan &timeSpan) const
-{
-
-}
 
+//----------------------------------------------------------------------------//
+// Helper Methods                                                             //
+//----------------------------------------------------------------------------//
 //------------------------------------------------------------------------------
-void DateTime::ToLocalTime()
+time_t DateTime::LocalUtcOffsetTicks(time_t utcTicks)
 {
-
+    return TimeZone::Local().UtcOffsetTicks(utcTicks);
 }
 
 //------------------------------------------------------------------------------
-void DateTime::ToUniversalTime()
+time_t DateTime::LocalToUtcTicks(time_t localTicks)
 {
-    // Nothing to convert...
-    if(m_kind == DateTimeKind::UTC)
-        return;
-
-
-
-}
-
-//----------------------------------------------------------------------------//
-// Helper Methods                                                             //
-//----------------------------------------------------------------------------//
-const DateTime::tm_t& DateTime::Update_tm() const
-{
-    if(!m_tmIsDirty)
-        return m_tm;
-
-    m_tm        = convert_to_tm(m_ticksSinceUnixEpoch, m_kind);
-    m_tmIsDirty = false;
-
-    return m_tm;
+    return TimeZone::Local().ToUtcTicks(localTicks);
 }
@@ -0,0 +1,660 @@
+// Header
+#include "../include/DateTimeBatch.h"
+// std
+#include <cstring>
+#include <stdexcept>
+// CoreTime
+#include "../include/CivilCalendar.h"
+#include "../include/TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+void store_fields(const CivilColumns &columns, size_t index, const CivilFields &fields)
+{
+    if(columns.year       ) columns.year       [index] = fields.year;
+    if(columns.month      ) columns.month      [index] = fields.month;
+    if(columns.day        ) columns.day        [index] = fields.day;
+    if(columns.hour       ) columns.hour       [index] = fields.hour;
+    if(columns.minute     ) columns.minute     [index] = fields.minute;
+    if(columns.second     ) columns.second     [index] = fields.second;
+    if(columns.millisecond) columns.millisecond[index] = fields.millisecond;
+    if(columns.dayOfWeek  ) columns.dayOfWeek  [index] = fields.dayOfWeek;
+    if(columns.dayOfYear  ) columns.dayOfYear  [index] = fields.dayOfYear;
+}
+
+//------------------------------------------------------------------------------
+void decompose_scalar(
+    const time_t       *ticks,
+    size_t             first,
+    size_t             last,
+    const CivilColumns &columns)
+{
+    for(auto i = first; i < last; ++i)
+        store_fields(columns, i, CivilCalendar::DecomposeTicks(ticks[i]));
+}
+
+
+//------------------------------------------------------------------------------
+// The rounding kernels do the range check of the DateTime constructor
+// along the way: The range is a power of two long, so once shifted to
+// start at 0 every value in it is under k_range_mask. The kernels OR the
+// shifted ticks and results together and the mask is checked once at the
+// end - Branchless, so it vectorizes even without 64 bits compares.
+// They also wrap the ticks into the range before rounding them, so out of
+// range ticks can't overflow (their results are thrown away anyway).
+constexpr std::uint64_t k_range_min  = std::uint64_t(DateTime::MinTicks);
+constexpr std::uint64_t k_range_mask = std::uint64_t(DateTime::MaxTicks) - k_range_min;
+static_assert((k_range_mask & (k_range_mask + 1)) == 0);
+
+
+//------------------------------------------------------------------------------
+enum class Rounding { Floor, Ceil, Round };
+
+//------------------------------------------------------------------------------
+// Rounds to the multiples of size shifted by offset.
+template <Rounding TRounding>
+inline time_t round_multiple(time_t ticks, time_t size, time_t offset)
+{
+    auto remainder = CivilCalendar::FloorMod(ticks - offset, size);
+    auto floor     = ticks - remainder;
+
+    if(TRounding == Rounding::Ceil)
+        return (remainder == 0) ? floor : floor + size;
+    if(TRounding == Rounding::Round)
+        return (remainder < size - remainder) ? floor : floor + size;
+
+    return floor;
+}
+
+//------------------------------------------------------------------------------
+// Returns the range bits - See k_range_mask.
+template <Rounding TRounding>
+std::uint64_t round_multiple_scalar(
+    const time_t *ticks,
+    time_t       *result,
+    size_t       first,
+    size_t       last,
+    time_t       size,
+    time_t       offset)
+{
+    auto bits = std::uint64_t(0);
+    for(auto i = first; i < last; ++i)
+    {
+        auto shifted = std::uint64_t(ticks[i]) - k_range_min;
+        auto value   = round_multiple<TRounding>(
+            time_t((shifted & k_range_mask) + k_range_min), size, offset
+        );
+
+        bits     |= shifted | (std::uint64_t(value) - k_range_min);
+        result[i] = value;
+    }
+
+    return bits;
+}
+
+//------------------------------------------------------------------------------
+template <Rounding TRounding>
+inline DateTime round_date_time(const DateTime &dateTime, DateTime::DateTimeUnit unit)
+{
+    if(TRounding == Rounding::Ceil)
+        return dateTime.Ceil(unit);
+    if(TRounding == Rounding::Round)
+        return dateTime.Round(unit);
+
+    return dateTime.Floor(unit);
+}
+
+
+#if defined(__x86_64__) || defined(__i386__)
+
+//------------------------------------------------------------------------------
+// The SIMD kernels are written once with the GCC/Clang vector extensions
+// and force inlined in wrappers compiled for each instruction set.
+//
+// Neither AVX2 nor SSE4.2 have 64 bits integer <-> double conversions or
+// divisions, so:
+//   - The ticks are turned into an approximated double by their 52 top
+//     bits, giving a days estimate that is off by at most one, and then the
+//     exact remainder is computed (and fixed) in 64 bits integers.
+//   - Everything after that is small and non negative, so the divisions
+//     are done as multiplications by the reciprocal of the divisor.
+//     For a numerator a < 2^22 and a divisor b, (a + 0.5) / b is at least
+//     0.5 / b away from any integer, which is more than the rounding error
+//     of the float multiplication - So truncating it is exact.
+//     The day of the era numerator can reach 2^23 - That one is a true
+//     (correctly rounded) division, which is also exact for a < 2^24.
+template <int N>
+struct Lanes
+{
+    typedef std::int32_t  I32 __attribute__((vector_size(N * 4)));
+    typedef float         F32 __attribute__((vector_size(N * 4)));
+    typedef std::int64_t  I64 __attribute__((vector_size(N * 8)));
+    typedef std::uint64_t U64 __attribute__((vector_size(N * 8)));
+    typedef double        F64 __attribute__((vector_size(N * 8)));
+};
+
+//------------------------------------------------------------------------------
+// Bits of 2^52 - OR'ing them into an integer < 2^52 and subtracting 2^52
+// converts it exactly to a double.
+constexpr std::uint64_t k_two_52_bits = 0x4330000000000000;
+constexpr double        k_two_52      = 4503599627370496.0;
+// 2^52 + 2^51 - Adding it to a double < 2^51 rounds it to an integer.
+constexpr double        k_round_magic = 6755399441055744.0;
+
+//------------------------------------------------------------------------------
+// A macro rather than a function - Vector return values from functions
+// without the target attribute make GCC warn about the ABI, even when the
+// function is always inlined.
+#define LANES_DIV(_value_, _divisor_)                                  \
+    __builtin_convertvector(                                           \
+        (__builtin_convertvector((_value_), F32) + 0.5f)               \
+            * (1.0f / float(_divisor_)),                               \
+        I32                                                            \
+    )
+
+//------------------------------------------------------------------------------
+template <typename I32>
+[[gnu::always_inline]] inline void lanes_store(std::int32_t *column, size_t index, const I32 &value)
+{
+    if(column)
+        std::memcpy(column + index, &value, sizeof(value));
+}
+
+//------------------------------------------------------------------------------
+template <int N>
+[[gnu::always_inline]] inline void decompose_lanes(
+    const time_t       *ticks,
+    size_t             index,
+    const CivilColumns &columns)
+{
+    using I32 = typename Lanes<N>::I32;
+    using F32 = typename Lanes<N>::F32;
+    using I64 = typename Lanes<N>::I64;
+    using U64 = typename Lanes<N>::U64;
+    using F64 = typename Lanes<N>::F64;
+
+    constexpr std::int32_t k_era_bias = 20; // Eras - Keeps z >= 0.
+
+    I64 t;
+    std::memcpy(&t, ticks + index, sizeof(t));
+
+    //--------------------------------------------------------------------------
+    // Days estimate - Flip the sign bit so the ticks become an order
+    // preserving unsigned, take its top 52 bits as a double and remove
+    // the flip back.
+    auto biased = U64(t) ^ (std::uint64_t(1) << 63);
+    auto approx = ((F64)((biased >> 12) | k_two_52_bits) - k_two_52) * 4096.0
+                - 9223372036854775808.0;
+
+    auto rounded = approx * (1.0 / TimeSpan::TicksPerDay) + k_round_magic;
+    auto days64  = (I64)rounded - (I64)(F64{} + k_round_magic);
+
+    //--------------------------------------------------------------------------
+    // Exact ticks of the day - The estimate is the floor or one past it.
+    auto tod  = t - days64 * TimeSpan::TicksPerDay;
+    auto past = (tod < 0);                                         // true is -1.
+    days64 += past;
+    tod    += past & TimeSpan::TicksPerDay;
+
+    auto tod_d = (F64)(U64(tod) | k_two_52_bits) - k_two_52 + 0.5;
+    auto sod   = __builtin_convertvector(tod_d * (1.0 / TimeSpan::TicksPerSecond),      I32);
+    auto msod  = __builtin_convertvector(tod_d * (1.0 / TimeSpan::TicksPerMillisecond), I32);
+    auto days  = __builtin_convertvector(days64, I32);
+
+    //--------------------------------------------------------------------------
+    // civil_from_days - See CivilCalendar::CivilFromDays.
+    I32 z   = days + std::int32_t(CivilCalendar::DaysFromEraStartToUnixEpoch
+                                + k_era_bias * CivilCalendar::DaysPerEra);
+    I32 era = __builtin_convertvector(
+        __builtin_convertvector(z, F32) / float(CivilCalendar::DaysPerEra),
+        I32
+    );
+    I32 doe = z - era * std::int32_t(CivilCalendar::DaysPerEra);
+    I32 yoe = LANES_DIV(
+        doe
+      - LANES_DIV(doe,   1460)
+      + LANES_DIV(doe,  36524)
+      - LANES_DIV(doe, 146096),
+        365
+    );
+    I32 doy = doe - (365 * yoe + LANES_DIV(yoe, 4) - LANES_DIV(yoe, 100));
+    I32 mp  = LANES_DIV(5 * doy + 2, 153);
+
+    I32 day   = doy - LANES_DIV(153 * mp + 2, 5) + 1;
+    I32 month = (mp < 10) ? (mp + 3) : (mp - 9);
+    I32 year  = yoe + (era - k_era_bias) * 400 - (month <= 2);    // true is -1.
+
+    //--------------------------------------------------------------------------
+    // The year is (era * 400 + yoe) so yoe alone tells if it is leap.
+    I32 leap = -(((yoe & 3) == 0) & ((yoe != LANES_DIV(yoe, 100) * 100) | (yoe == 0)));
+    I32 yday = (month > 2) ? (doy + 60 + leap) : (doy - 305);
+
+    //--------------------------------------------------------------------------
+    // An era has a whole number of weeks, so the weekday comes from the
+    // day of the era alone - The era started on a Wednesday.
+    I32 wd   = doe + 3;
+    I32 wday = wd - 7 * LANES_DIV(wd, 7);
+
+    //--------------------------------------------------------------------------
+    // Time of the day.
+    I32 minutes = LANES_DIV(sod, 60);
+    I32 hour    = LANES_DIV(sod, 3600);
+    I32 minute  = minutes - hour    * 60;
+    I32 second  = sod     - minutes * 60;
+    I32 ms      = msod    - sod     * 1000;
+
+    lanes_store(columns.year,        index, year  );
+    lanes_store(columns.month,       index, month );
+    lanes_store(columns.day,         index, day   );
+    lanes_store(columns.hour,        index, hour  );
+    lanes_store(columns.minute,      index, minute);
+    lanes_store(columns.second,      index, second);
+    lanes_store(columns.millisecond, index, ms    );
+    lanes_store(columns.dayOfWeek,   index, wday  );
+    lanes_store(columns.dayOfYear,   index, yday  );
+}
+
+//------------------------------------------------------------------------------
+__attribute__((target("avx2")))
+void decompose_avx2(const time_t *ticks, size_t count, const CivilColumns &columns)
+{
+    auto i = size_t(0);
+    for(; i + 8 <= count; i += 8)
+        decompose_lanes<8>(ticks, i, columns);
+
+    decompose_scalar(ticks, i, count, columns);
+}
+
+//------------------------------------------------------------------------------
+__attribute__((target("sse4.2")))
+void decompose_sse42(const time_t *ticks, size_t count, const CivilColumns &columns)
+{
+    auto i = size_t(0);
+    for(; i + 4 <= count; i += 4)
+        decompose_lanes<4>(ticks, i, columns);
+
+    decompose_scalar(ticks, i, count, columns);
+}
+
+//------------------------------------------------------------------------------
+// Same days estimate of decompose_lanes but with any divisor - The
+// estimate is at most 4096 ticks below the true value, so the quotient
+// is the floor or one past it as long as the divisor is larger than
+// 2 * 4096 ticks (and the quotient fits in the 51 bits of k_round_magic).
+template <int N, Rounding TRounding>
+[[gnu::always_inline]] inline void round_multiple_lanes(
+    const time_t            *ticks,
+    time_t                  *result,
+    size_t                  index,
+    time_t                  size,
+    time_t                  offset,
+    typename Lanes<N>::U64 &bits)
+{
+    using I64 = typename Lanes<N>::I64;
+    using U64 = typename Lanes<N>::U64;
+    using F64 = typename Lanes<N>::F64;
+
+    I64 t;
+    std::memcpy(&t, ticks + index, sizeof(t));
+
+    auto shifted = U64(t) - k_range_min;
+    t = I64((shifted & k_range_mask) + k_range_min) - offset;
+
+    auto biased = U64(t) ^ (std::uint64_t(1) << 63);
+    auto approx = ((F64)((biased >> 12) | k_two_52_bits) - k_two_52) * 4096.0
+                - 9223372036854775808.0;
+
+    auto rounded   = approx * (1.0 / double(size)) + k_round_magic;
+    auto quotient  = (I64)rounded - (I64)(F64{} + k_round_magic);
+    auto remainder = t - quotient * size;
+    remainder     += (remainder < 0) & size;                    // true is -1.
+
+    auto value = t - remainder + offset;
+    if(TRounding == Rounding::Ceil)
+        value += (remainder != 0) & size;
+    if(TRounding == Rounding::Round)
+        value += (remainder >= size - remainder) & size;
+
+    bits |= shifted | (U64(value) - k_range_min);
+    std::memcpy(result + index, &value, sizeof(value));
+}
+
+//------------------------------------------------------------------------------
+// At the native width of each instruction set - Wider vectors of 64 bits
+// lanes are split in registers and the range bits get spilled.
+template <Rounding TRounding>
+__attribute__((target("avx2")))
+std::uint64_t round_multiple_avx2(
+    const time_t *ticks,
+    time_t       *result,
+    size_t       count,
+    time_t       size,
+    time_t       offset)
+{
+    auto lane_bits = typename Lanes<4>::U64{};
+    auto i         = size_t(0);
+    for(; i + 4 <= count; i += 4)
+        round_multiple_lanes<4, TRounding>(ticks, result, i, size, offset, lane_bits);
+
+    auto bits = round_multiple_scalar<TRounding>(ticks, result, i, count, size, offset);
+    for(int lane = 0; lane < 4; ++lane)
+        bits |= lane_bits[lane];
+
+    return bits;
+}
+
+//------------------------------------------------------------------------------
+template <Rounding TRounding>
+__attribute__((target("sse4.2")))
+std::uint64_t round_multiple_sse42(
+    const time_t *ticks,
+    time_t       *result,
+    size_t       count,
+    time_t       size,
+    time_t       offset)
+{
+    auto lane_bits = typename Lanes<2>::U64{};
+    auto i         = size_t(0);
+    for(; i + 2 <= count; i += 2)
+        round_multiple_lanes<2, TRounding>(ticks, result, i, size, offset, lane_bits);
+
+    auto bits = round_multiple_scalar<TRounding>(ticks, result, i, count, size, offset);
+    for(int lane = 0; lane < 2; ++lane)
+        bits |= lane_bits[lane];
+
+    return bits;
+}
+
+#undef LANES_DIV
+
+#endif // defined(__x86_64__) || defined(__i386__)
+
+
+//------------------------------------------------------------------------------
+template <Rounding TRounding>
+std::uint64_t round_multiple_values(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    time_t                  size,
+    time_t                  offset,
+    DateTimeBatch::Kernel   kernel)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if(size >= TimeSpan::TicksPerMillisecond)
+    {
+        if(kernel == DateTimeBatch::Kernel::AVX2)
+        {
+            return round_multiple_avx2<TRounding>(
+                ticks.data(), result.data(), ticks.size(), size, offset
+            );
+        }
+        if(kernel == DateTimeBatch::Kernel::SSE42)
+        {
+            return round_multiple_sse42<TRounding>(
+                ticks.data(), result.data(), ticks.size(), size, offset
+            );
+        }
+    }
+#endif
+
+    return round_multiple_scalar<TRounding>(
+        ticks.data(), result.data(), 0, ticks.size(), size, offset
+    );
+}
+
+//------------------------------------------------------------------------------
+template <Rounding TRounding>
+void round_multiple(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    time_t                  size,
+    time_t                  offset,
+    DateTimeBatch::Kernel   kernel)
+{
+    if(result.size() < ticks.size())
+        throw std::invalid_argument("DateTimeBatch - Result is too small");
+
+    auto bits = round_multiple_values<TRounding>(ticks, result, size, offset, kernel);
+    if((bits & ~k_range_mask) != 0)
+        throw std::out_of_range("DateTimeBatch - Ticks out of range");
+}
+
+//------------------------------------------------------------------------------
+template <Rounding TRounding>
+void round_unit(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    DateTime::DateTimeUnit  unit,
+    DateTimeBatch::Kernel   kernel)
+{
+    using Unit = DateTime::DateTimeUnit;
+
+    switch(unit)
+    {
+        case Unit::Tick:        return round_multiple<TRounding>(ticks, result, 1, 0, kernel);
+        case Unit::Millisecond: return round_multiple<TRounding>(ticks, result, TimeSpan::TicksPerMillisecond, 0, kernel);
+        case Unit::Second:      return round_multiple<TRounding>(ticks, result, TimeSpan::TicksPerSecond, 0, kernel);
+        case Unit::Minute:      return round_multiple<TRounding>(ticks, result, TimeSpan::TicksPerMinute, 0, kernel);
+        case Unit::Hour:        return round_multiple<TRounding>(ticks, result, TimeSpan::TicksPerHour, 0, kernel);
+        case Unit::Day:         return round_multiple<TRounding>(ticks, result, TimeSpan::TicksPerDay, 0, kernel);
+
+        //----------------------------------------------------------------------
+        // Weeks start on the Monday before 1970-01-01 (a Thursday).
+        case Unit::Week:
+            return round_multiple<TRounding>(
+                ticks, result, 7 * TimeSpan::TicksPerDay, -3 * TimeSpan::TicksPerDay, kernel
+            );
+
+        default:
+            break;
+    }
+
+    if(result.size() < ticks.size())
+        throw std::invalid_argument("DateTimeBatch - Result is too small");
+
+    for(size_t i = 0; i < ticks.size(); ++i)
+        result[i] = round_date_time<TRounding>(DateTime(ticks[i]), unit).Ticks();
+}
+
+//------------------------------------------------------------------------------
+template <Rounding TRounding>
+void round_size(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    const TimeSpan          &size,
+    DateTimeBatch::Kernel   kernel)
+{
+    if(size.Ticks() <= 0)
+        throw std::invalid_argument("DateTimeBatch - Rounding size must be positive");
+
+    round_multiple<TRounding>(ticks, result, size.Ticks(), 0, kernel);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+DateTimeBatch::Kernel DateTimeBatch::BestKernel()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    static const auto s_kernel = []() {
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2"  )) return Kernel::AVX2;
+        if(__builtin_cpu_supports("sse4.2")) return Kernel::SSE42;
+        return Kernel::Scalar;
+    }();
+    return s_kernel;
+#else
+    return Kernel::Scalar;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Decompose(
+    std::span<const time_t> ticks,
+    const CivilColumns      &columns)
+{
+    Decompose(ticks, columns, BestKernel());
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Decompose(
+    std::span<const time_t> ticks,
+    const CivilColumns      &columns,
+    Kernel                  kernel)
+{
+    if(int(kernel) > int(BestKernel()))
+        kernel = BestKernel();
+
+#if defined(__x86_64__) || defined(__i386__)
+    if(kernel == Kernel::AVX2)
+        return decompose_avx2(ticks.data(), ticks.size(), columns);
+
+    if(kernel == Kernel::SSE42)
+        return decompose_sse42(ticks.data(), ticks.size(), columns);
+#endif
+
+    decompose_scalar(ticks.data(), 0, ticks.size(), columns);
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Floor(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    DateTime::DateTimeUnit  unit)
+{
+    Floor(ticks, result, unit, BestKernel());
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Floor(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    const TimeSpan          &size)
+{
+    Floor(ticks, result, size, BestKernel());
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Ceil(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    DateTime::DateTimeUnit  unit)
+{
+    Ceil(ticks, result, unit, BestKernel());
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Ceil(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    const TimeSpan          &size)
+{
+    Ceil(ticks, result, size, BestKernel());
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Round(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    DateTime::DateTimeUnit  unit)
+{
+    Round(ticks, result, unit, BestKernel());
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Round(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    const TimeSpan          &size)
+{
+    Round(ticks, result, size, BestKernel());
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Floor(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    DateTime::DateTimeUnit  unit,
+    Kernel                  kernel)
+{
+    if(int(kernel) > int(BestKernel()))
+        kernel = BestKernel();
+
+    round_unit<Rounding::Floor>(ticks, result, unit, kernel);
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Floor(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    const TimeSpan          &size,
+    Kernel                  kernel)
+{
+    if(int(kernel) > int(BestKernel()))
+        kernel = BestKernel();
+
+    round_size<Rounding::Floor>(ticks, result, size, kernel);
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Ceil(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    DateTime::DateTimeUnit  unit,
+    Kernel                  kernel)
+{
+    if(int(kernel) > int(BestKernel()))
+        kernel = BestKernel();
+
+    round_unit<Rounding::Ceil>(ticks, result, unit, kernel);
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Ceil(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    const TimeSpan          &size,
+    Kernel                  kernel)
+{
+    if(int(kernel) > int(BestKernel()))
+        kernel = BestKernel();
+
+    round_size<Rounding::Ceil>(ticks, result, size, kernel);
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Round(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    DateTime::DateTimeUnit  unit,
+    Kernel                  kernel)
+{
+    if(int(kernel) > int(BestKernel()))
+        kernel = BestKernel();
+
+    round_unit<Rounding::Round>(ticks, result, unit, kernel);
+}
+
+//------------------------------------------------------------------------------
+void DateTimeBatch::Round(
+    std::span<const time_t> ticks,
+    std::span<time_t>       result,
+    const TimeSpan          &size,
+    Kernel                  kernel)
+{
+    if(int(kernel) > int(BestKernel()))
+        kernel = BestKernel();
+
+    round_size<Rounding::Round>(ticks, result, size, kernel);
+}
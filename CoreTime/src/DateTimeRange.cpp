@@ -0,0 +1,174 @@
+// Header
+#include "../include/DateTimeRange.h"
+// std
+#include <algorithm>
+#include <stdexcept>
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Number of steps from 0 before reaching diff - Zero if they go in
+// opposite directions.
+time_t count_tick_steps(time_t diff, time_t step)
+{
+    if(diff > 0 && step > 0)
+        return (diff + step - 1) / step;
+    if(diff < 0 && step < 0)
+        return (diff + step + 1) / step;
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+time_t unit_ticks(DateTime::DateTimeUnit unit)
+{
+    switch(unit)
+    {
+        case DateTime::DateTimeUnit::Tick:        return 1;
+        case DateTime::DateTimeUnit::Millisecond: return TimeSpan::TicksPerMillisecond;
+        case DateTime::DateTimeUnit::Second:      return TimeSpan::TicksPerSecond;
+        case DateTime::DateTimeUnit::Minute:      return TimeSpan::TicksPerMinute;
+        case DateTime::DateTimeUnit::Hour:        return TimeSpan::TicksPerHour;
+        case DateTime::DateTimeUnit::Day:         return TimeSpan::TicksPerDay;
+        case DateTime::DateTimeUnit::Week:        return TimeSpan::TicksPerDay * 7;
+        default:                                  return 0;
+    }
+}
+
+//------------------------------------------------------------------------------
+time_t unit_months(DateTime::DateTimeUnit unit)
+{
+    switch(unit)
+    {
+        case DateTime::DateTimeUnit::Month:   return 1;
+        case DateTime::DateTimeUnit::Quarter: return 3;
+        case DateTime::DateTimeUnit::Year:    return 12;
+        default:                              return 0;
+    }
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+DateTimeRange::DateTimeRange(
+    const DateTime &first,
+    const DateTime &last,
+    const TimeSpan &step) :
+    m_first     (first),
+    m_stepTicks (step.Ticks()),
+    m_stepMonths(0),
+    m_count     (0)
+{
+    if(m_stepTicks == 0)
+        throw std::invalid_argument("DateTimeRange - Step can't be zero");
+
+    m_count = size_t(count_tick_steps(last.Ticks() - first.Ticks(), m_stepTicks));
+}
+
+//------------------------------------------------------------------------------
+DateTimeRange::DateTimeRange(
+    const DateTime         &first,
+    const DateTime         &last,
+    DateTime::DateTimeUnit unit,
+    time_t                 count /* = 1 */) :
+    m_first     (first),
+    m_stepTicks (unit_ticks (unit) * count),
+    m_stepMonths(unit_months(unit) * count),
+    m_count     (0)
+{
+    if(count == 0)
+        throw std::invalid_argument("DateTimeRange - Step can't be zero");
+
+    m_count = (m_stepMonths != 0)
+        ? CountMonthSteps(last)
+        : size_t(count_tick_steps(last.Ticks() - first.Ticks(), m_stepTicks));
+}
+
+
+//----------------------------------------------------------------------------//
+// Getters                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+DateTime DateTimeRange::At(size_t index) const
+{
+    if(index >= m_count)
+        throw std::out_of_range("DateTimeRange - Index out of range");
+
+    return (*this)[index];
+}
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void DateTimeRange::FillTicks(size_t first, std::span<time_t> ticks) const
+{
+    if(first > m_count || ticks.size() > m_count - first)
+        throw std::out_of_range("DateTimeRange - Range out of range");
+
+    if(m_stepMonths != 0)
+    {
+        for(size_t i = 0; i < ticks.size(); ++i)
+            ticks[i] = (*this)[first + i].Ticks();
+
+        return;
+    }
+
+    auto base = m_first.Ticks() + time_t(first) * m_stepTicks;
+    auto step = m_stepTicks;
+    auto out  = ticks.data();
+    auto size = ticks.size();
+
+    for(size_t i = 0; i < size; ++i)
+        out[i] = base + time_t(i) * step;
+}
+
+
+//----------------------------------------------------------------------------//
+// Helper Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+size_t DateTimeRange::CountMonthSteps(const DateTime &last) const
+{
+    auto last_ticks = last.Ticks();
+    auto forward    = (m_stepMonths > 0);
+    auto before     = [&](size_t index) {
+        //----------------------------------------------------------------------
+        // Steps past the DateTime range are past last as well.
+        try
+        {
+            auto ticks = (*this)[index].Ticks();
+            return forward ? (ticks < last_ticks) : (ticks > last_ticks);
+        }
+        catch(const std::out_of_range &)
+        {
+            return false;
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    // The months between the wall clocks give the count give or take one,
+    // AddMonths never goes back so walk from there to the first value
+    // that isn't before last.
+    auto months = (last   .Year() * 12 + last   .Month())
+                - (m_first.Year() * 12 + m_first.Month());
+    auto count  = size_t(std::max<time_t>(months / m_stepMonths, 0));
+
+    while(count > 0 && !before(count - 1))
+        --count;
+    while(before(count))
+        ++count;
+
+    return count;
+}
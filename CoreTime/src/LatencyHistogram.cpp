@@ -0,0 +1,206 @@
+// Header
+#include "../include/LatencyHistogram.h"
+// std
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Smallest value that falls in the given bucket - The inverse of
+// LatencyHistogram::BucketIndex.
+std::uint64_t bucket_lowest_value(size_t index, int significantBits)
+{
+    auto group  = index >> significantBits;
+    auto offset = index & ((size_t(1) << significantBits) - 1);
+
+    if(group <= 1)
+        return index;
+
+    return ((size_t(1) << significantBits) + offset) << (group - 1);
+}
+
+//------------------------------------------------------------------------------
+// Largest value that falls in the given bucket.
+std::uint64_t bucket_highest_value(size_t index, int significantBits)
+{
+    return bucket_lowest_value(index + 1, significantBits) - 1;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Snapshot                                                                   //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+LatencyHistogram::Snapshot::Snapshot(int significantBits) :
+    m_significantBits(significantBits),
+    m_buckets        (),
+    m_count          (0),
+    m_sumTicks       (0)
+{
+    // Empty...
+}
+
+//------------------------------------------------------------------------------
+TimeSpan LatencyHistogram::Snapshot::Min() const
+{
+    for(size_t i = 0; i < m_buckets.size(); ++i)
+    {
+        if(m_buckets[i] != 0)
+            return TimeSpan(time_t(bucket_lowest_value(i, m_significantBits)));
+    }
+
+    return TimeSpan::Zero();
+}
+
+//------------------------------------------------------------------------------
+TimeSpan LatencyHistogram::Snapshot::Max() const
+{
+    for(size_t i = m_buckets.size(); i > 0; --i)
+    {
+        if(m_buckets[i - 1] != 0)
+            return TimeSpan(time_t(bucket_highest_value(i - 1, m_significantBits)));
+    }
+
+    return TimeSpan::Zero();
+}
+
+//------------------------------------------------------------------------------
+TimeSpan LatencyHistogram::Snapshot::Mean() const
+{
+    if(m_count == 0)
+        return TimeSpan::Zero();
+
+    return TimeSpan(time_t(m_sumTicks / m_count));
+}
+
+//------------------------------------------------------------------------------
+TimeSpan LatencyHistogram::Snapshot::Percentile(double percentile) const
+{
+    if(m_count == 0)
+        return TimeSpan::Zero();
+
+    //--------------------------------------------------------------------------
+    // Rank of the value in [1, count].
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    auto rank  = std::uint64_t(std::ceil(percentile / 100.0 * double(m_count)));
+    rank       = std::clamp<std::uint64_t>(rank, 1, m_count);
+
+    auto seen = std::uint64_t(0);
+    for(size_t i = 0; i < m_buckets.size(); ++i)
+    {
+        seen += m_buckets[i];
+        if(seen >= rank)
+            return TimeSpan(time_t(bucket_highest_value(i, m_significantBits)));
+    }
+
+    return Max();
+}
+
+//------------------------------------------------------------------------------
+void LatencyHistogram::Snapshot::Merge(const Snapshot &other)
+{
+    if(other.m_significantBits != m_significantBits)
+    {
+        throw std::invalid_argument(
+            "LatencyHistogram - Can't merge snapshots with different significant bits"
+        );
+    }
+
+    //--------------------------------------------------------------------------
+    // The bucket of a value depends only on the significant bits, so the
+    // ranges only differ on how many buckets there are.
+    if(m_buckets.size() < other.m_buckets.size())
+        m_buckets.resize(other.m_buckets.size(), 0);
+
+    for(size_t i = 0; i < other.m_buckets.size(); ++i)
+        m_buckets[i] += other.m_buckets[i];
+
+    m_count    += other.m_count;
+    m_sumTicks += other.m_sumTicks;
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+LatencyHistogram::LatencyHistogram(
+    const TimeSpan &highestTrackable,
+    int            significantBits /* = 7 */,
+    size_t         shardCount      /* = 0 */) :
+    m_significantBits(significantBits),
+    m_highestTicks   (0),
+    m_bucketCount    (0),
+    m_shards         ()
+{
+    if(highestTrackable.Ticks() <= 0)
+        throw std::invalid_argument("LatencyHistogram - highestTrackable must be positive");
+    if(significantBits < 1 || significantBits > 16)
+        throw std::invalid_argument("LatencyHistogram - significantBits must be in [1, 16]");
+
+    if(shardCount == 0)
+        shardCount = std::max(1u, std::thread::hardware_concurrency());
+
+    m_highestTicks = std::uint64_t(highestTrackable.Ticks());
+    m_bucketCount  = BucketIndex(m_highestTicks) + 1;
+
+    //--------------------------------------------------------------------------
+    // The shards hold atomics, so they are built in place and never moved.
+    m_shards = std::vector<Shard>(shardCount);
+    for(auto &shard : m_shards)
+    {
+        shard.buckets.reset(new std::atomic<std::uint64_t>[m_bucketCount]);
+        shard.sumTicks.store(0, std::memory_order_relaxed);
+    }
+
+    Reset();
+}
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const
+{
+    auto snapshot = Snapshot(m_significantBits);
+    snapshot.m_buckets.assign(m_bucketCount, 0);
+
+    for(const auto &shard : m_shards)
+    {
+        for(size_t i = 0; i < m_bucketCount; ++i)
+        {
+            auto count = shard.buckets[i].load(std::memory_order_relaxed);
+
+            snapshot.m_buckets[i] += count;
+            snapshot.m_count      += count;
+        }
+
+        snapshot.m_sumTicks += shard.sumTicks.load(std::memory_order_relaxed);
+    }
+
+    return snapshot;
+}
+
+//------------------------------------------------------------------------------
+void LatencyHistogram::Reset()
+{
+    for(auto &shard : m_shards)
+    {
+        for(size_t i = 0; i < m_bucketCount; ++i)
+            shard.buckets[i].store(0, std::memory_order_relaxed);
+
+        shard.sumTicks.store(0, std::memory_order_relaxed);
+    }
+}
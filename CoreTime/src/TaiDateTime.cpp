@@ -0,0 +1,131 @@
+// Header
+#include "../include/TaiDateTime.h"
+// std
+#include <algorithm>
+#include <array>
+#include <limits>
+// CoreTime
+#include "../include/CivilCalendar.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Dates (UTC midnight) where TAI - UTC went up by one second, the leap
+// second being the last one of the day before - From the IERS Bulletin C.
+constexpr std::int16_t k_leap_dates[][3] = {
+    { 1972,  7, 1 }, { 1973,  1, 1 }, { 1974,  1, 1 }, { 1975,  1, 1 },
+    { 1976,  1, 1 }, { 1977,  1, 1 }, { 1978,  1, 1 }, { 1979,  1, 1 },
+    { 1980,  1, 1 }, { 1981,  7, 1 }, { 1982,  7, 1 }, { 1983,  7, 1 },
+    { 1985,  7, 1 }, { 1988,  1, 1 }, { 1990,  1, 1 }, { 1991,  1, 1 },
+    { 1992,  7, 1 }, { 1993,  7, 1 }, { 1994,  7, 1 }, { 1996,  1, 1 },
+    { 1997,  7, 1 }, { 1999,  1, 1 }, { 2006,  1, 1 }, { 2009,  1, 1 },
+    { 2012,  7, 1 }, { 2015,  7, 1 }, { 2017,  1, 1 },
+};
+
+constexpr time_t k_base_offset = 10 * TimeSpan::TicksPerSecond;
+
+//------------------------------------------------------------------------------
+struct LeapEntry
+{
+    time_t utcTicks;    // First UTC tick with this offset.
+    time_t taiTicks;    // First TAI tick of the leap second.
+    time_t offset;      // TAI - UTC in ticks.
+};
+
+//------------------------------------------------------------------------------
+// The first entry covers everything before the first leap second.
+constexpr auto k_leap_count = std::size(k_leap_dates) + 1;
+constexpr auto k_leap_table = []() {
+    auto table = std::array<LeapEntry, k_leap_count>{};
+    table[0]   = LeapEntry{
+        std::numeric_limits<time_t>::min(),
+        std::numeric_limits<time_t>::min(),
+        k_base_offset
+    };
+
+    for(size_t i = 1; i < k_leap_count; ++i)
+    {
+        const auto &date = k_leap_dates[i - 1];
+
+        auto utc    = CivilCalendar::DaysFromCivil(date[0], date[1], date[2])
+                    * TimeSpan::TicksPerDay;
+        auto offset = k_base_offset + time_t(i) * TimeSpan::TicksPerSecond;
+
+        table[i] = LeapEntry{ utc, utc + offset - TimeSpan::TicksPerSecond, offset };
+    }
+
+    return table;
+}();
+
+//------------------------------------------------------------------------------
+// Index of the last entry starting at or before the given ticks. Each
+// thread (and each key) keeps the index of its last lookup - Which is
+// the right one unless the ticks crossed a leap second since then.
+template <time_t LeapEntry::*TKey>
+size_t find_leap_entry(time_t ticks)
+{
+    thread_local auto t_index = k_leap_count - 1;
+
+    auto index = t_index;
+    if(ticks >= k_leap_table[index].*TKey
+    && (index + 1 == k_leap_count || ticks < k_leap_table[index + 1].*TKey))
+    {
+        return index;
+    }
+
+    auto it = std::upper_bound(
+        k_leap_table.begin(),
+        k_leap_table.end(),
+        ticks,
+        [](time_t value, const LeapEntry &entry) { return value < entry.*TKey; }
+    );
+
+    t_index = size_t(it - k_leap_table.begin()) - 1;
+    return t_index;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Getters                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+bool TaiDateTime::IsLeapSecond() const
+{
+    //--------------------------------------------------------------------------
+    // Entries start at their leap second (but the first one).
+    auto index = find_leap_entry<&LeapEntry::taiTicks>(m_ticks);
+    return index != 0
+        && m_ticks - k_leap_table[index].offset < k_leap_table[index].utcTicks;
+}
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+DateTime TaiDateTime::ToUtc() const
+{
+    //--------------------------------------------------------------------------
+    // Inside the leap second this lands on the second before the new
+    // offset starts - 23:59:59.
+    auto index = find_leap_entry<&LeapEntry::taiTicks>(m_ticks);
+    return DateTime(m_ticks - k_leap_table[index].offset, DateTime::DateTimeKind::UTC);
+}
+
+
+//----------------------------------------------------------------------------//
+// Helper Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+time_t TaiDateTime::UtcToTaiOffsetTicks(time_t utcTicks)
+{
+    return k_leap_table[find_leap_entry<&LeapEntry::utcTicks>(utcTicks)].offset;
+}
@@ -0,0 +1,214 @@
+// Header
+#include "../include/TimeColumn.h"
+// std
+#include <cstring>
+#include <stdexcept>
+// POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+constexpr char k_magic[8] = { 'C', 'T', 'C', 'O', 'L', 'U', 'M', 'N' };
+
+//------------------------------------------------------------------------------
+// DateTime and TimeSpan are written and mapped as their own 8 bytes.
+static_assert(sizeof(DateTime) == sizeof(std::int64_t));
+static_assert(sizeof(TimeSpan) == sizeof(std::int64_t));
+
+
+//----------------------------------------------------------------------------//
+// TimeColumnWriter                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TimeColumnWriter::TimeColumnWriter(
+    const std::string     &path,
+    TimeColumn::ValueType valueType) :
+    m_stream(path, std::ios::binary | std::ios::trunc),
+    m_header()
+{
+    if(!m_stream)
+        throw std::runtime_error("TimeColumnWriter - Can't open: " + path);
+
+    std::memcpy(m_header.magic, k_magic, sizeof(k_magic));
+    m_header.version    = TimeColumn::Version;
+    m_header.valueType  = valueType;
+    m_header.kind       = 0;
+    m_header.epochTicks = 0;
+    m_header.tickUnit   = 1;
+    m_header.count      = 0;
+
+    m_stream.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+}
+
+//------------------------------------------------------------------------------
+TimeColumnWriter::~TimeColumnWriter()
+{
+    //--------------------------------------------------------------------------
+    // Destructors can't throw - Call Close to know about write errors.
+    try
+    {
+        Close();
+    }
+    catch(...)
+    {
+        // Empty...
+    }
+}
+
+//------------------------------------------------------------------------------
+void TimeColumnWriter::Append(std::span<const DateTime> dateTimes)
+{
+    if(m_header.valueType != TimeColumn::ValueType::DateTime)
+        throw std::invalid_argument("TimeColumnWriter - Not a DateTime column");
+
+    for(const auto &dateTime : dateTimes)
+    {
+        auto kind = std::uint8_t(dateTime.Kind());
+        if(m_header.count == 0)
+            m_header.kind = kind;
+        else if(m_header.kind != kind)
+            m_header.kind = TimeColumn::MixedKinds;
+
+        ++m_header.count;
+    }
+
+    m_stream.write(
+        reinterpret_cast<const char*>(dateTimes.data()),
+        std::streamsize(dateTimes.size_bytes())
+    );
+}
+
+//------------------------------------------------------------------------------
+void TimeColumnWriter::Append(std::span<const TimeSpan> timeSpans)
+{
+    if(m_header.valueType != TimeColumn::ValueType::TimeSpan)
+        throw std::invalid_argument("TimeColumnWriter - Not a TimeSpan column");
+
+    m_header.count += timeSpans.size();
+    m_stream.write(
+        reinterpret_cast<const char*>(timeSpans.data()),
+        std::streamsize(timeSpans.size_bytes())
+    );
+}
+
+//------------------------------------------------------------------------------
+void TimeColumnWriter::Close()
+{
+    if(!m_stream.is_open())
+        return;
+
+    m_stream.seekp(0);
+    m_stream.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+
+    auto failed = !m_stream;
+    m_stream.close();
+
+    if(failed)
+        throw std::runtime_error("TimeColumnWriter - Failed to write the column");
+}
+
+
+//----------------------------------------------------------------------------//
+// TimeColumnReader                                                           //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TimeColumnReader::TimeColumnReader(const std::string &path) :
+    m_mapping    (nullptr),
+    m_mappingSize(0),
+    m_header     (nullptr)
+{
+    auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+        throw std::runtime_error("TimeColumnReader - Can't open: " + path);
+
+    struct stat _stat;
+    if(fstat(fd, &_stat) != 0 || size_t(_stat.st_size) < sizeof(TimeColumn::Header))
+    {
+        close(fd);
+        throw std::runtime_error("TimeColumnReader - Not a TimeColumn file: " + path);
+    }
+
+    m_mappingSize = size_t(_stat.st_size);
+    m_mapping     = mmap(nullptr, m_mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if(m_mapping == MAP_FAILED)
+    {
+        m_mapping = nullptr;
+        throw std::runtime_error("TimeColumnReader - Can't map: " + path);
+    }
+
+    //--------------------------------------------------------------------------
+    // Validate the header before trusting the count.
+    m_header = static_cast<const TimeColumn::Header*>(m_mapping);
+
+    auto values_size = m_mappingSize - sizeof(TimeColumn::Header);
+    auto valid_type  = m_header->valueType == TimeColumn::ValueType::DateTime
+                    || m_header->valueType == TimeColumn::ValueType::TimeSpan;
+
+    if(std::memcmp(m_header->magic, k_magic, sizeof(k_magic)) != 0
+    || m_header->version != TimeColumn::Version
+    || !valid_type
+    || m_header->tickUnit <= 0
+    || m_header->count > values_size / sizeof(std::int64_t))
+    {
+        munmap(m_mapping, m_mappingSize);
+        m_mapping = nullptr;
+
+        throw std::runtime_error("TimeColumnReader - Not a TimeColumn file: " + path);
+    }
+}
+
+//------------------------------------------------------------------------------
+TimeColumnReader::~TimeColumnReader()
+{
+    if(m_mapping)
+        munmap(m_mapping, m_mappingSize);
+}
+
+//------------------------------------------------------------------------------
+std::span<const std::int64_t> TimeColumnReader::RawValues() const
+{
+    return std::span<const std::int64_t>(
+        reinterpret_cast<const std::int64_t*>(m_header + 1),
+        Count()
+    );
+}
+
+//------------------------------------------------------------------------------
+std::span<const DateTime> TimeColumnReader::DateTimes() const
+{
+    return std::span<const DateTime>(
+        static_cast<const DateTime*>(Values(TimeColumn::ValueType::DateTime)),
+        Count()
+    );
+}
+
+//------------------------------------------------------------------------------
+std::span<const TimeSpan> TimeColumnReader::TimeSpans() const
+{
+    return std::span<const TimeSpan>(
+        static_cast<const TimeSpan*>(Values(TimeColumn::ValueType::TimeSpan)),
+        Count()
+    );
+}
+
+//------------------------------------------------------------------------------
+const void* TimeColumnReader::Values(TimeColumn::ValueType valueType) const
+{
+    if(m_header->valueType != valueType)
+        throw std::logic_error("TimeColumnReader - Wrong value type");
+
+    if(m_header->epochTicks != 0 || m_header->tickUnit != 1)
+        throw std::logic_error("TimeColumnReader - Values aren't in plain ticks");
+
+    return m_header + 1;
+}
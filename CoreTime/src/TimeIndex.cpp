@@ -0,0 +1,256 @@
+// Header
+#include "../include/TimeIndex.h"
+// std
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// std::lower_bound with a conditional move instead of a branch.
+size_t branchless_lower_bound(const time_t *first, size_t count, time_t ticks)
+{
+    if(count == 0)
+        return 0;
+
+    auto base = first;
+    while(count > 1)
+    {
+        auto half = count / 2;
+        base   = (base[half] < ticks) ? base + half : base;
+        count -= half;
+    }
+
+    return size_t(base - first) + (*base < ticks);
+}
+
+//------------------------------------------------------------------------------
+// Values of a block that are less than the ticks - The block is sorted, so
+// that is where the lower bound is. Counting (instead of searching)
+// has no branches to mispredict and vectorizes.
+size_t count_less(const time_t *first, size_t count, time_t ticks)
+{
+    auto less = size_t(0);
+    for(size_t i = 0; i < count; ++i)
+        less += (first[i] < ticks);
+
+    return less;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TimeIndex::TimeIndex(
+    std::span<const time_t> ticks,
+    Model                   model /* = Model::Eytzinger */) :
+    m_ticks       (ticks),
+    m_model       (model),
+    m_samples     (),
+    m_sampleBlocks(),
+    m_bucketWidth (1),
+    m_bucketScale (1.0),
+    m_bucketStarts(),
+    m_bucketErrors()
+{
+    if(!std::is_sorted(ticks.begin(), ticks.end()))
+        throw std::invalid_argument("TimeIndex - Ticks must be sorted");
+
+    if(m_model == Model::Eytzinger)
+        BuildEytzinger();
+    else
+        BuildPiecewiseLinear();
+}
+
+
+//----------------------------------------------------------------------------//
+// Getters                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+size_t TimeIndex::ByteSize() const
+{
+    return m_samples     .size() * sizeof(time_t)
+         + m_sampleBlocks.size() * sizeof(size_t)
+         + m_bucketStarts.size() * sizeof(size_t)
+         + m_bucketErrors.size() * sizeof(std::uint32_t);
+}
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+size_t TimeIndex::LowerBound(time_t ticks) const
+{
+    if(m_ticks.empty())
+        return 0;
+
+    return (m_model == Model::Eytzinger)
+        ? EytzingerLowerBound      (ticks)
+        : PiecewiseLinearLowerBound(ticks);
+}
+
+//------------------------------------------------------------------------------
+std::pair<size_t, size_t> TimeIndex::Range(const DateTime &from, const DateTime &to) const
+{
+    auto first = LowerBound(from);
+    auto last  = LowerBound(to);
+
+    return std::make_pair(first, std::max(first, last));
+}
+
+
+//----------------------------------------------------------------------------//
+// Helper Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void TimeIndex::BuildEytzinger()
+{
+    auto count = (m_ticks.size() + BlockSize - 1) / BlockSize;
+
+    m_samples     .assign(count + 1, 0);
+    m_sampleBlocks.assign(count + 1, 0);
+
+    //--------------------------------------------------------------------------
+    // In order walk of the implicit tree (children of k are 2k and 2k + 1)
+    // handing out the samples in sorted order.
+    auto block = size_t(0);
+    auto node  = size_t(1);
+    auto stack = std::vector<size_t>();
+
+    while(node <= count || !stack.empty())
+    {
+        for(; node <= count; node *= 2)
+            stack.push_back(node);
+
+        node = stack.back();
+        stack.pop_back();
+
+        m_samples     [node] = m_ticks[block * BlockSize];
+        m_sampleBlocks[node] = block;
+        ++block;
+
+        node = node * 2 + 1;
+    }
+}
+
+//------------------------------------------------------------------------------
+void TimeIndex::BuildPiecewiseLinear()
+{
+    auto count   = m_ticks.size();
+    auto buckets = std::max<size_t>(count / BlockSize, 1);
+    if(count == 0)
+        return;
+
+    //--------------------------------------------------------------------------
+    // Unsigned, since the span of the ticks can be larger than a time_t.
+    auto first = m_ticks.front();
+    auto span  = std::uint64_t(m_ticks.back()) - std::uint64_t(first);
+
+    m_bucketWidth = span / buckets + 1;
+    m_bucketScale = 1.0 / double(m_bucketWidth);
+    buckets       = size_t(span / m_bucketWidth) + 1;
+
+    m_bucketStarts.assign(buckets + 1, count);
+    m_bucketErrors.assign(buckets,     0);
+
+    for(size_t i = count; i-- > 0;)
+        m_bucketStarts[(std::uint64_t(m_ticks[i]) - std::uint64_t(first)) / m_bucketWidth] = i;
+    for(size_t b = buckets; b-- > 0;)
+        m_bucketStarts[b] = std::min(m_bucketStarts[b], m_bucketStarts[b + 1]);
+
+    //--------------------------------------------------------------------------
+    // Largest distance between the interpolated and the true positions.
+    for(size_t i = 0; i < count; ++i)
+    {
+        auto offset = std::uint64_t(m_ticks[i]) - std::uint64_t(first);
+        auto b      = size_t(offset / m_bucketWidth);
+        auto size   = double(m_bucketStarts[b + 1] - m_bucketStarts[b]);
+        auto guess  = double(m_bucketStarts[b])
+                    + double(offset - b * m_bucketWidth) * size * m_bucketScale;
+
+        auto error = std::uint32_t(std::ceil(std::fabs(guess - double(i))));
+        m_bucketErrors[b] = std::max(m_bucketErrors[b], error);
+    }
+}
+
+//------------------------------------------------------------------------------
+size_t TimeIndex::EytzingerLowerBound(time_t ticks) const
+{
+    auto count = m_samples.size() - 1;
+    auto data  = m_samples.data();
+
+    //--------------------------------------------------------------------------
+    // Descend to a leaf going right while the sample is less than the
+    // ticks - The great-grandchildren of a node are 8 consecutive values
+    // (a cache line), fetched 3 levels ahead.
+    auto node = size_t(1);
+    while(node <= count)
+    {
+        __builtin_prefetch(data + node * 8);
+        node = node * 2 + (data[node] < ticks);
+    }
+
+    //--------------------------------------------------------------------------
+    // Remove the right turns taken after the last left one - That node is
+    // the first sample not less than the ticks (0 if there is none).
+    node >>= __builtin_ffsll(~std::int64_t(node));
+
+    auto block = (node == 0) ? count : m_sampleBlocks[node];
+    if(block == 0)
+        return 0;
+
+    //--------------------------------------------------------------------------
+    // The lower bound is after the first value of the previous block and
+    // not after the first value of this one.
+    auto first = (block - 1) * BlockSize + 1;
+    auto last  = std::min(block * BlockSize, m_ticks.size());
+
+    return first + count_less(m_ticks.data() + first, last - first, ticks);
+}
+
+//------------------------------------------------------------------------------
+size_t TimeIndex::PiecewiseLinearLowerBound(time_t ticks) const
+{
+    auto count = m_ticks.size();
+    if(ticks <= m_ticks.front())
+        return 0;
+    if(ticks > m_ticks.back())
+        return count;
+
+    //--------------------------------------------------------------------------
+    // The bucket by the float reciprocal, fixed to the exact one.
+    auto offset  = std::uint64_t(ticks) - std::uint64_t(m_ticks.front());
+    auto buckets = m_bucketErrors.size();
+    auto b       = std::min(size_t(double(offset) * m_bucketScale), buckets - 1);
+
+    if(b > 0 && offset < b * m_bucketWidth)
+        --b;
+    else if(b + 1 < buckets && offset >= (b + 1) * m_bucketWidth)
+        ++b;
+
+    //--------------------------------------------------------------------------
+    // Search around the interpolated position - Within the bucket error,
+    // plus one for the rounding and for lower bounds between two values.
+    auto start = m_bucketStarts[b];
+    auto end   = m_bucketStarts[b + 1];
+    auto guess = start + size_t(
+        double(offset - b * m_bucketWidth) * double(end - start) * m_bucketScale
+    );
+
+    auto error = size_t(m_bucketErrors[b]) + 1;
+    auto first = std::max(start, (guess > error) ? guess - error : 0);
+    auto last  = std::min(end,   guess + error + 1);
+
+    return first + branchless_lower_bound(m_ticks.data() + first, last - first, ticks);
+}
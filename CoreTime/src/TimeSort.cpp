@@ -0,0 +1,36 @@
+// Header
+#include "../include/TimeSort.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void TimeSort::SortByTime(std::span<DateTime> values)
+{
+    Sort(values.data(), static_cast<NoPayload*>(nullptr), values.size(), 1);
+}
+
+//------------------------------------------------------------------------------
+void TimeSort::SortByTime(std::span<TimeSpan> values)
+{
+    Sort(values.data(), static_cast<NoPayload*>(nullptr), values.size(), 1);
+}
+
+//------------------------------------------------------------------------------
+void TimeSort::ParallelSortByTime(
+    std::span<DateTime> values,
+    unsigned            threadCount /* = 0 */)
+{
+    Sort(values.data(), static_cast<NoPayload*>(nullptr), values.size(), threadCount);
+}
+
+//------------------------------------------------------------------------------
+void TimeSort::ParallelSortByTime(
+    std::span<TimeSpan> values,
+    unsigned            threadCount /* = 0 */)
+{
+    Sort(values.data(), static_cast<NoPayload*>(nullptr), values.size(), threadCount);
+}
@@ -0,0 +1,709 @@
+// Header
+#include "../include/TimeZone.h"
+// std
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+// CoreTime
+#include "../include/CivilCalendar.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Last period found by each thread in each zone - Consecutive lookups of
+// nearby times (the common case) skip the search altogether. Zones take
+// the slots in turn, so up to k_period_cache_size zones can be used
+// alternately (e.g. when converting between them) without evicting each
+// other.
+struct PeriodCache
+{
+    const TimeZone   *zone;
+    TimeZone::Period period;
+};
+
+constexpr std::uint32_t k_period_cache_size = 16;
+
+thread_local PeriodCache t_period_cache[k_period_cache_size] = {};
+
+//------------------------------------------------------------------------------
+std::uint32_t next_period_cache_slot()
+{
+    static std::atomic<std::uint32_t> s_nextSlot(0);
+    return s_nextSlot.fetch_add(1, std::memory_order_relaxed) % k_period_cache_size;
+}
+
+constexpr time_t k_min_ticks = std::numeric_limits<time_t>::min();
+constexpr time_t k_max_ticks = std::numeric_limits<time_t>::max();
+
+//------------------------------------------------------------------------------
+time_t seconds_to_ticks(std::int64_t seconds)
+{
+    //--------------------------------------------------------------------------
+    // TZif files use "big bang" sentinels far outside the DateTime range.
+    if(seconds <= DateTime::MinTicks / TimeSpan::TicksPerSecond)
+        return DateTime::MinTicks;
+    if(seconds >= DateTime::MaxTicks / TimeSpan::TicksPerSecond)
+        return DateTime::MaxTicks;
+
+    return seconds * TimeSpan::TicksPerSecond;
+}
+
+//------------------------------------------------------------------------------
+std::int64_t read_be(const std::uint8_t *data, int size)
+{
+    std::uint64_t value = 0;
+    for(int i = 0; i < size; ++i)
+        value = (value << 8) | data[i];
+
+    //--------------------------------------------------------------------------
+    // Sign extend 32 bits values.
+    if(size == 4)
+        return std::int32_t(std::uint32_t(value));
+
+    return std::int64_t(value);
+}
+
+//------------------------------------------------------------------------------
+bool read_file(const std::string &path, std::vector<std::uint8_t> &data)
+{
+    std::ifstream file(path, std::ios::binary);
+    if(!file)
+        return false;
+
+    data.assign(
+        std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>()
+    );
+    return !data.empty();
+}
+
+//------------------------------------------------------------------------------
+const std::string& zoneinfo_directory()
+{
+    static const std::string s_directory = []() {
+        auto tzdir = std::getenv("TZDIR");
+        return std::string((tzdir && tzdir[0]) ? tzdir : "/usr/share/zoneinfo");
+    }();
+    return s_directory;
+}
+
+//------------------------------------------------------------------------------
+// Zones are created once and never destroyed - So the thread caches and
+// the pointers handed out are never dangling, even at exit.
+std::mutex& zones_mutex()
+{
+    static auto s_mutex = new std::mutex();
+    return *s_mutex;
+}
+
+std::unordered_map<std::string, TimeZone*>& zones_by_id()
+{
+    static auto s_zones = new std::unordered_map<std::string, TimeZone*>();
+    return *s_zones;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TimeZone::TimeZone(const std::string &id) :
+    m_id       (id),
+    m_hasRule  (false),
+    m_rule     (),
+    m_cacheSlot(next_period_cache_slot())
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Zones                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+const TimeZone& TimeZone::Utc()
+{
+    static const TimeZone *s_utc = []() {
+        auto zone = new TimeZone("UTC");
+        zone->m_types.push_back({0, false});
+        return zone;
+    }();
+    return *s_utc;
+}
+
+//------------------------------------------------------------------------------
+const TimeZone& TimeZone::Local()
+{
+    static const TimeZone *s_local = []() -> const TimeZone* {
+        auto tz = std::getenv("TZ");
+
+        //----------------------------------------------------------------------
+        // No TZ - The system zone.
+        if(!tz)
+        {
+            auto zone = LoadFile("Local", "/etc/localtime");
+            return (zone) ? zone : &Utc();
+        }
+
+        //----------------------------------------------------------------------
+        // TZ is one of: ":id", ":/path", "id", "/path" or a POSIX TZ string.
+        auto value = std::string(tz);
+        if(!value.empty() && value[0] == ':')
+            value.erase(0, 1);
+
+        if(value.empty())
+            return &Utc();
+
+        const TimeZone *zone = (value[0] == '/')
+            ? LoadFile(value, value)
+            : FindSystemTimeZoneById(value);
+
+        if(!zone)
+            zone = LoadPosixRule(value, value);
+
+        return (zone) ? zone : &Utc();
+    }();
+
+    return *s_local;
+}
+
+//------------------------------------------------------------------------------
+const TimeZone* TimeZone::FindSystemTimeZoneById(const std::string &id)
+{
+    //--------------------------------------------------------------------------
+    // Ids are relative paths inside the zoneinfo directory - Don't let
+    // them point anywhere else.
+    if(id.empty() || id[0] == '/' || id.find("..") != std::string::npos)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(zones_mutex());
+
+    auto &zones = zones_by_id();
+    auto it     = zones.find(id);
+    if(it != zones.end())
+        return it->second;
+
+    auto zone = LoadFile(id, zoneinfo_directory() + "/" + id);
+    if(zone)
+        zones.emplace(id, zone);
+
+    return zone;
+}
+
+
+//----------------------------------------------------------------------------//
+// Methods                                                                    //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TimeZone::Period TimeZone::GetPeriod(time_t utcTicks) const
+{
+    auto &cache = t_period_cache[m_cacheSlot];
+    if(cache.zone == this
+    && cache.period.from  <= utcTicks
+    && cache.period.until >  utcTicks)
+    {
+        return cache.period;
+    }
+
+    auto period = Period{};
+    if(m_transitions.empty())
+    {
+        //----------------------------------------------------------------------
+        // Only a rule, or a fixed offset zone.
+        if(m_hasRule)
+            period = RulePeriod(utcTicks);
+        else
+            period = Period{k_min_ticks, k_max_ticks, m_types[0].utcOffset, m_types[0].isDst};
+    }
+    else if(utcTicks < m_transitions.front())
+    {
+        //----------------------------------------------------------------------
+        // RFC 8536 - Before the first transition the first type is used.
+        period = Period{
+            k_min_ticks,
+            m_transitions.front(),
+            m_types[0].utcOffset,
+            m_types[0].isDst
+        };
+    }
+    else
+    {
+        auto it    = std::upper_bound(m_transitions.begin(), m_transitions.end(), utcTicks);
+        auto index = size_t(std::distance(m_transitions.begin(), it) - 1);
+        auto &type = m_types[m_transitionTypes[index]];
+
+        if(it != m_transitions.end())
+        {
+            period = Period{m_transitions[index], *it, type.utcOffset, type.isDst};
+        }
+        else if(m_hasRule)
+        {
+            //------------------------------------------------------------------
+            // After the last transition the footer rule takes over.
+            period      = RulePeriod(utcTicks);
+            period.from = std::max(period.from, m_transitions.back());
+        }
+        else
+        {
+            period = Period{m_transitions.back(), k_max_ticks, type.utcOffset, type.isDst};
+        }
+    }
+
+    cache.zone   = this;
+    cache.period = period;
+
+    return period;
+}
+
+//------------------------------------------------------------------------------
+time_t TimeZone::ToUtcTicks(time_t localTicks) const
+{
+    //--------------------------------------------------------------------------
+    // Zones don't change their offset more than once a day, so the local
+    // time is either valid with the offset of the day before, with the
+    // offset of the day after, with both (ambiguous) or with none (gap).
+    auto before = UtcOffsetTicks(localTicks - TimeSpan::TicksPerDay);
+    auto after  = UtcOffsetTicks(localTicks + TimeSpan::TicksPerDay);
+
+    auto utc_before = localTicks - before;
+    auto utc_after  = localTicks - after;
+
+    auto before_is_valid = (UtcOffsetTicks(utc_before) == before);
+    auto after_is_valid  = (UtcOffsetTicks(utc_after ) == after );
+
+    if(before_is_valid && after_is_valid)
+        return std::min(utc_before, utc_after);
+
+    if(after_is_valid)
+        return utc_after;
+
+    //--------------------------------------------------------------------------
+    // Valid with the previous offset or in a gap - In the later case this
+    // lands after the gap, moved forward by its length.
+    return utc_before;
+}
+
+//------------------------------------------------------------------------------
+TimeSpan TimeZone::GetUtcOffset(const DateTime &dateTime) const
+{
+    auto ticks = dateTime.Ticks();
+    if(dateTime.Kind() == DateTime::DateTimeKind::None)
+        ticks = ToUtcTicks(ticks);
+
+    return TimeSpan(UtcOffsetTicks(ticks));
+}
+
+//------------------------------------------------------------------------------
+bool TimeZone::IsDaylightSavingTime(const DateTime &dateTime) const
+{
+    auto ticks = dateTime.Ticks();
+    if(dateTime.Kind() == DateTime::DateTimeKind::None)
+        ticks = ToUtcTicks(ticks);
+
+    return GetPeriod(ticks).isDst;
+}
+
+//------------------------------------------------------------------------------
+DateTime TimeZone::ConvertFromUtc(const DateTime &dateTime) const
+{
+    auto ticks = dateTime.Ticks();
+    return DateTime(ticks + UtcOffsetTicks(ticks), DateTime::DateTimeKind::None);
+}
+
+//------------------------------------------------------------------------------
+DateTime TimeZone::ConvertToUtc(const DateTime &dateTime) const
+{
+    auto ticks = dateTime.Ticks();
+    if(dateTime.Kind() == DateTime::DateTimeKind::None)
+        ticks = ToUtcTicks(ticks);
+
+    return DateTime(ticks, DateTime::DateTimeKind::UTC);
+}
+
+//------------------------------------------------------------------------------
+DateTime TimeZone::ConvertTime(
+    const DateTime &dateTime,
+    const TimeZone &sourceZone,
+    const TimeZone &destinationZone)
+{
+    return destinationZone.ConvertFromUtc(sourceZone.ConvertToUtc(dateTime));
+}
+
+
+//----------------------------------------------------------------------------//
+// Helper Methods                                                             //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+TimeZone* TimeZone::LoadFile(const std::string &id, const std::string &path)
+{
+    std::vector<std::uint8_t> data;
+    if(!read_file(path, data))
+        return nullptr;
+
+    auto zone = new TimeZone(id);
+    if(!zone->ParseTZif(data))
+    {
+        delete zone;
+        return nullptr;
+    }
+
+    return zone;
+}
+
+//------------------------------------------------------------------------------
+TimeZone* TimeZone::LoadPosixRule(const std::string &id, const std::string &tz)
+{
+    auto zone = new TimeZone(id);
+    if(!zone->ParsePosixRule(tz))
+    {
+        delete zone;
+        return nullptr;
+    }
+
+    zone->m_types.push_back({zone->m_rule.stdOffset, false});
+    return zone;
+}
+
+//------------------------------------------------------------------------------
+bool TimeZone::ParseTZif(const std::vector<std::uint8_t> &data)
+{
+    //--------------------------------------------------------------------------
+    // Reference:
+    //   https://www.rfc-editor.org/rfc/rfc8536
+    constexpr size_t k_header_size = 44;
+
+    struct Header
+    {
+        std::int64_t isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt;
+    };
+
+    auto read_header = [&data](size_t offset, Header &header, char &version) {
+        if(data.size() < offset + k_header_size)
+            return false;
+        if(std::string(data.begin() + offset, data.begin() + offset + 4) != "TZif")
+            return false;
+
+        auto counts = data.data() + offset + 20;
+        version         = char(data[offset + 4]);
+        header.isutcnt  = read_be(counts +  0, 4);
+        header.isstdcnt = read_be(counts +  4, 4);
+        header.leapcnt  = read_be(counts +  8, 4);
+        header.timecnt  = read_be(counts + 12, 4);
+        header.typecnt  = read_be(counts + 16, 4);
+        header.charcnt  = read_be(counts + 20, 4);
+
+        return header.isutcnt  >= 0 && header.isstdcnt >= 0
+            && header.leapcnt  >= 0 && header.timecnt  >= 0
+            && header.typecnt  >= 1 && header.charcnt  >= 0;
+    };
+
+    auto block_size = [](const Header &header, size_t timeSize) {
+        return size_t(header.timecnt)  * (timeSize + 1)
+             + size_t(header.typecnt)  * 6
+             + size_t(header.charcnt)
+             + size_t(header.leapcnt)  * (timeSize + 4)
+             + size_t(header.isstdcnt)
+             + size_t(header.isutcnt);
+    };
+
+    //--------------------------------------------------------------------------
+    // Version 1 has 32 bits times only - Later versions repeat everything
+    // with 64 bits times after it, followed by the POSIX TZ footer.
+    auto header    = Header{};
+    auto version   = char(0);
+    auto offset    = size_t(0);
+    auto time_size = size_t(4);
+
+    if(!read_header(offset, header, version))
+        return false;
+
+    if(version >= '2')
+    {
+        offset   += k_header_size + block_size(header, 4);
+        time_size = 8;
+
+        if(!read_header(offset, header, version))
+            return false;
+    }
+
+    auto data_offset = offset + k_header_size;
+    auto data_end    = data_offset + block_size(header, time_size);
+    if(data.size() < data_end)
+        return false;
+
+    //--------------------------------------------------------------------------
+    // Transitions, their types and the types.
+    auto times = data.data() + data_offset;
+    auto types = times + header.timecnt * time_size;
+    auto infos = types + header.timecnt;
+
+    m_transitions    .resize(header.timecnt);
+    m_transitionTypes.resize(header.timecnt);
+    for(std::int64_t i = 0; i < header.timecnt; ++i)
+    {
+        m_transitions    [i] = seconds_to_ticks(read_be(times + i * time_size, int(time_size)));
+        m_transitionTypes[i] = types[i];
+
+        if(m_transitionTypes[i] >= header.typecnt)
+            return false;
+    }
+
+    m_types.resize(header.typecnt);
+    for(std::int64_t i = 0; i < header.typecnt; ++i)
+    {
+        m_types[i].utcOffset = std::int32_t(read_be(infos + i * 6, 4));
+        m_types[i].isDst     = (infos[i * 6 + 4] != 0);
+    }
+
+    //--------------------------------------------------------------------------
+    // Footer - "\nTZ\n" - The rule for times after the last transition.
+    if(time_size == 8 && data_end < data.size() && data[data_end] == '\n')
+    {
+        auto first = data.begin() + data_end + 1;
+        auto last  = std::find(first, data.end(), '\n');
+        auto tz    = std::string(first, last);
+
+        if(last != data.end() && !tz.empty())
+            m_hasRule = ParsePosixRule(tz);
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+bool TimeZone::ParsePosixRule(const std::string &tz)
+{
+    //--------------------------------------------------------------------------
+    // Reference:
+    //   https://pubs.opengroup.org/onlinepubs/9699919799/basedefs/V1_chap08.html
+    //   std offset [dst [offset] [,start[/time],end[/time]]]
+    auto i = size_t(0);
+
+    auto at = [&tz, &i](char c) { return i < tz.size() && tz[i] == c; };
+
+    auto parse_name = [&]() {
+        if(at('<'))
+        {
+            auto close = tz.find('>', i);
+            if(close == std::string::npos)
+                return false;
+
+            i = close + 1;
+            return true;
+        }
+
+        auto start = i;
+        while(i < tz.size() && std::isalpha((unsigned char)tz[i]))
+            ++i;
+
+        return (i - start) >= 3;
+    };
+
+    auto parse_number = [&](std::int32_t &value) {
+        auto start = i;
+        value = 0;
+        while(i < tz.size() && std::isdigit((unsigned char)tz[i]) && i - start < 3)
+            value = value * 10 + (tz[i++] - '0');
+
+        return i > start;
+    };
+
+    // [+|-]hh[:mm[:ss]] as seconds.
+    auto parse_time = [&](std::int32_t &seconds) {
+        auto sign = 1;
+        if(at('+') || at('-'))
+            sign = (tz[i++] == '-') ? -1 : 1;
+
+        std::int32_t hours = 0, minutes = 0, secs = 0;
+        if(!parse_number(hours))
+            return false;
+        if(at(':') && (++i, !parse_number(minutes)))
+            return false;
+        if(at(':') && (++i, !parse_number(secs)))
+            return false;
+
+        seconds = sign * (hours * 3600 + minutes * 60 + secs);
+        return true;
+    };
+
+    auto parse_date = [&](RuleDate &date) {
+        date.time = 2 * 3600;
+        if(at('J'))
+        {
+            ++i;
+            date.type = RuleDate::Type::JulianNoLeap;
+            if(!parse_number(date.day) || date.day < 1 || date.day > 365)
+                return false;
+        }
+        else if(at('M'))
+        {
+            ++i;
+            date.type = RuleDate::Type::MonthWeekDay;
+            if(!parse_number(date.month) || date.month < 1 || date.month > 12) return false;
+            if(!at('.') || (++i, !parse_number(date.week)) || date.week  < 1 || date.week > 5) return false;
+            if(!at('.') || (++i, !parse_number(date.day )) || date.day   < 0 || date.day  > 6) return false;
+        }
+        else
+        {
+            date.type = RuleDate::Type::JulianZeroBased;
+            if(!parse_number(date.day) || date.day > 365)
+                return false;
+        }
+
+        if(at('/'))
+        {
+            ++i;
+            return parse_time(date.time);
+        }
+        return true;
+    };
+
+    //--------------------------------------------------------------------------
+    // Standard time - POSIX offsets are west of UTC, ours are east.
+    auto rule = Rule{};
+    if(!parse_name() || !parse_time(rule.stdOffset))
+        return false;
+
+    rule.stdOffset = -rule.stdOffset;
+    rule.dstOffset =  rule.stdOffset;
+    rule.hasDst    =  (i < tz.size());
+
+    //--------------------------------------------------------------------------
+    // Daylight saving time.
+    if(rule.hasDst)
+    {
+        if(!parse_name())
+            return false;
+
+        rule.dstOffset = rule.stdOffset + 3600;
+        if(i < tz.size() && !at(','))
+        {
+            if(!parse_time(rule.dstOffset))
+                return false;
+
+            rule.dstOffset = -rule.dstOffset;
+        }
+
+        if(at(','))
+        {
+            ++i;
+            if(!parse_date(rule.dstStart) || !at(',') || (++i, !parse_date(rule.dstEnd)))
+                return false;
+        }
+        else
+        {
+            //------------------------------------------------------------------
+            // No dates - Same default as glibc (US rules).
+            rule.dstStart = RuleDate{RuleDate::Type::MonthWeekDay, 0, 2,  3, 2 * 3600};
+            rule.dstEnd   = RuleDate{RuleDate::Type::MonthWeekDay, 0, 1, 11, 2 * 3600};
+        }
+    }
+
+    if(i != tz.size())
+        return false;
+
+    m_rule = rule;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+TimeZone::Period TimeZone::RulePeriod(time_t utcTicks) const
+{
+    if(!m_rule.hasDst)
+        return Period{k_min_ticks, k_max_ticks, m_rule.stdOffset, false};
+
+    auto std_ticks = time_t(m_rule.stdOffset) * TimeSpan::TicksPerSecond;
+    auto days      = CivilCalendar::FloorDiv(utcTicks + std_ticks, TimeSpan::TicksPerDay);
+    auto year      = CivilCalendar::CivilFromDays(days).year;
+
+    //--------------------------------------------------------------------------
+    // DST starts at a local standard time and ends at a local DST time.
+    auto start = [this](time_t y) {
+        return RuleDateToUtc(y, m_rule.dstStart, m_rule.stdOffset);
+    };
+    auto end = [this](time_t y) {
+        return RuleDateToUtc(y, m_rule.dstEnd, m_rule.dstOffset);
+    };
+
+    auto dst_start = start(year);
+    auto dst_end   = end  (year);
+
+    auto std_period = [this](time_t from, time_t until) {
+        return Period{from, until, m_rule.stdOffset, false};
+    };
+    auto dst_period = [this](time_t from, time_t until) {
+        return Period{from, until, m_rule.dstOffset, true};
+    };
+
+    if(dst_start < dst_end)
+    {
+        if(utcTicks < dst_start) return std_period(end(year - 1), dst_start);
+        if(utcTicks < dst_end  ) return dst_period(dst_start, dst_end);
+        return std_period(dst_end, start(year + 1));
+    }
+
+    //--------------------------------------------------------------------------
+    // Southern hemisphere - DST spans the new year.
+    if(utcTicks < dst_end  ) return dst_period(start(year - 1), dst_end);
+    if(utcTicks < dst_start) return std_period(dst_end, dst_start);
+    return dst_period(dst_start, end(year + 1));
+}
+
+//------------------------------------------------------------------------------
+time_t TimeZone::RuleDateToUtc(
+    time_t          year,
+    const RuleDate  &date,
+    std::int32_t    offset) const
+{
+    auto days = CivilCalendar::DaysFromCivil(year, 1, 1);
+    switch(date.type)
+    {
+        //----------------------------------------------------------------------
+        // Jn - [1, 365] - February 29 is never counted.
+        case RuleDate::Type::JulianNoLeap:
+            days += date.day - 1;
+            if(date.day >= 60 && CivilCalendar::IsLeapYear(year))
+                ++days;
+        break;
+
+        //----------------------------------------------------------------------
+        // n - [0, 365] - February 29 is counted.
+        case RuleDate::Type::JulianZeroBased:
+            days += date.day;
+        break;
+
+        //----------------------------------------------------------------------
+        // Mm.w.d - Day d of week w of month m - Week 5 is the last one.
+        case RuleDate::Type::MonthWeekDay:
+        {
+            auto first    = CivilCalendar::DaysFromCivil(year, date.month, 1);
+            auto weekday  = CivilCalendar::FloorMod(first + 4, 7);
+            auto mday     = 1 + CivilCalendar::FloorMod(date.day - weekday, 7)
+                          + (date.week - 1) * 7;
+
+            auto last_day = CivilCalendar::DaysInMonth(date.month, year);
+            while(mday > last_day)
+                mday -= 7;
+
+            days = first + mday - 1;
+        }
+        break;
+    }
+
+    return days         * TimeSpan::TicksPerDay
+         + (date.time   - time_t(offset)) * TimeSpan::TicksPerSecond;
+}
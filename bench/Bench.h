@@ -0,0 +1,161 @@
+#pragma once
+
+// std
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <utility>
+
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   The tiny harness shared by the benchmark executables. Every result is
+///   written to stdout as a CSV row, so runs can be diffed and tracked:
+///     suite,case,impl,metric,value
+///
+///   Times are the best of a few repetitions, each one running the code
+///   for at least MinRunTime - Set CORETIME_BENCH_QUICK in the environment
+///   to shorten them (e.g. as a smoke test).
+class Bench
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef std::chrono::steady_clock steady_clock_t;
+
+    static constexpr int                       Repetitions = 5;
+    static constexpr std::chrono::milliseconds MinRunTime  { 50 };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit Bench(std::string suite) :
+        m_suite  (std::move(suite)),
+        m_isQuick(std::getenv("CORETIME_BENCH_QUICK") != nullptr)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Methods                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes the CSV header - Once per executable.
+    static void PrintHeader()
+    {
+        std::printf("suite,case,impl,metric,value\n");
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Writes a single result.
+    void Report(
+        const std::string &caseName,
+        const std::string &impl,
+        const std::string &metric,
+        double             value) const
+    {
+        std::printf(
+            "%s,%s,%s,%s,%.3f\n",
+            m_suite.c_str(), caseName.c_str(), impl.c_str(), metric.c_str(), value
+        );
+        std::fflush(stdout);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Calls func (that processes the given number of items) over and over
+    ///   and reports the nanoseconds per item as ns_per_op.
+    template <typename TFunc>
+    double Run(
+        const std::string &caseName,
+        const std::string &impl,
+        size_t             items,
+        TFunc            &&func) const
+    {
+        auto min_run_time = (m_isQuick) ? MinRunTime / 10 : MinRunTime;
+        auto best         = std::numeric_limits<double>::max();
+
+        for(int i = 0; i < Repetitions; ++i)
+        {
+            auto calls   = size_t(0);
+            auto start   = steady_clock_t::now();
+            auto elapsed = steady_clock_t::duration(0);
+            do {
+                func();
+                ++calls;
+                elapsed = steady_clock_t::now() - start;
+            } while(elapsed < min_run_time);
+
+            best = std::min(best, NsPerItem(elapsed, calls * items));
+        }
+
+        Report(caseName, impl, "ns_per_op", best);
+        return best;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Same as Run for code that consumes its input (e.g. sorting) - The
+    ///   setup is called before each timed call of func and isn't timed.
+    template <typename TSetup, typename TFunc>
+    double RunWithSetup(
+        const std::string &caseName,
+        const std::string &impl,
+        size_t             items,
+        TSetup           &&setup,
+        TFunc            &&func) const
+    {
+        auto best = std::numeric_limits<double>::max();
+        for(int i = 0; i < Repetitions; ++i)
+        {
+            setup();
+
+            auto start = steady_clock_t::now();
+            func();
+            auto elapsed = steady_clock_t::now() - start;
+
+            best = std::min(best, NsPerItem(elapsed, items));
+        }
+
+        Report(caseName, impl, "ns_per_op", best);
+        return best;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Keeps the compiler from optimizing away the computation of value.
+    template <typename T>
+    static void DoNotOptimize(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+private:
+    static double NsPerItem(steady_clock_t::duration elapsed, size_t items)
+    {
+        return std::chrono::duration<double, std::nano>(elapsed).count()
+             / double(std::max<size_t>(items, 1));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string m_suite;
+    bool        m_isQuick;
+};
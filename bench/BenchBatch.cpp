@@ -0,0 +1,145 @@
+// std
+#include <cstdint>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "DateTimeBatch.h"
+#include "TimeSpan.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef DateTimeBatch::Kernel Kernel;
+
+constexpr size_t k_count = 1 << 16;
+
+//------------------------------------------------------------------------------
+const char *kernel_name(Kernel kernel)
+{
+    switch(kernel)
+    {
+        case Kernel::AVX2:  return "CoreTime_AVX2";
+        case Kernel::SSE42: return "CoreTime_SSE42";
+        default:            return "CoreTime_Scalar";
+    }
+}
+
+//------------------------------------------------------------------------------
+// Uniform ticks over 1900-2100.
+std::vector<time_t> make_ticks()
+{
+    auto rng          = std::mt19937_64(42);
+    auto distribution = std::uniform_int_distribution<time_t>(
+        DateTime(1900, 1, 1, 0, 0, 0, 0).Ticks(), DateTime(2100, 1, 1, 0, 0, 0, 0).Ticks()
+    );
+
+    auto ticks = std::vector<time_t>(k_count);
+    for(auto &value : ticks)
+        value = distribution(rng);
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+void report_values_per_s(const Bench &bench, const std::string &caseName, const std::string &impl, double ns)
+{
+    bench.Report(caseName, impl, "values_per_s", 1e9 / ns);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Usage: BenchBatch
+//
+// Each kernel is forced in turn - The ones the CPU doesn't support run the
+// best one instead, so they aren't reported. The DateTime getters and
+// methods called value by value are the baseline.
+int main()
+{
+    auto bench = Bench("Batch");
+    auto best  = DateTimeBatch::BestKernel();
+
+    Bench::PrintHeader();
+    bench.Report("Input", "All", "values", double(k_count));
+
+    auto ticks = make_ticks();
+
+    //--------------------------------------------------------------------------
+    // Decompose - Every column.
+    auto columns = std::vector<std::vector<std::int32_t>>(9, std::vector<std::int32_t>(k_count));
+    auto civil   = CivilColumns{
+        columns[0].data(), columns[1].data(), columns[2].data(),
+        columns[3].data(), columns[4].data(), columns[5].data(),
+        columns[6].data(), columns[7].data(), columns[8].data()
+    };
+
+    auto ns = bench.Run("Decompose", "DateTime_Fields", k_count, [&]() {
+        for(size_t i = 0; i < k_count; ++i)
+        {
+            auto fields = DateTime(ticks[i]).Fields();
+            civil.year       [i] = fields.year;
+            civil.month      [i] = fields.month;
+            civil.day        [i] = fields.day;
+            civil.hour       [i] = fields.hour;
+            civil.minute     [i] = fields.minute;
+            civil.second     [i] = fields.second;
+            civil.millisecond[i] = fields.millisecond;
+            civil.dayOfWeek  [i] = fields.dayOfWeek;
+            civil.dayOfYear  [i] = fields.dayOfYear;
+        }
+        Bench::DoNotOptimize(civil.year[0]);
+    });
+    report_values_per_s(bench, "Decompose", "DateTime_Fields", ns);
+
+    for(auto kernel : { Kernel::Scalar, Kernel::SSE42, Kernel::AVX2 })
+    {
+        if(int(kernel) > int(best))
+            continue;
+
+        ns = bench.Run("Decompose", kernel_name(kernel), k_count, [&]() {
+            DateTimeBatch::Decompose(ticks, civil, kernel);
+            Bench::DoNotOptimize(civil.year[0]);
+        });
+        report_values_per_s(bench, "Decompose", kernel_name(kernel), ns);
+    }
+
+    //--------------------------------------------------------------------------
+    // Floor to the minute - A plain multiple.
+    auto result = std::vector<time_t>(k_count);
+
+    ns = bench.Run("FloorMinute", "DateTime_Floor", k_count, [&]() {
+        for(size_t i = 0; i < k_count; ++i)
+            result[i] = DateTime(ticks[i]).Floor(DateTime::DateTimeUnit::Minute).Ticks();
+        Bench::DoNotOptimize(result[0]);
+    });
+    report_values_per_s(bench, "FloorMinute", "DateTime_Floor", ns);
+
+    for(auto kernel : { Kernel::Scalar, Kernel::SSE42, Kernel::AVX2 })
+    {
+        if(int(kernel) > int(best))
+            continue;
+
+        ns = bench.Run("FloorMinute", kernel_name(kernel), k_count, [&]() {
+            DateTimeBatch::Floor(ticks, result, DateTime::DateTimeUnit::Minute, kernel);
+            Bench::DoNotOptimize(result[0]);
+        });
+        report_values_per_s(bench, "FloorMinute", kernel_name(kernel), ns);
+    }
+
+    return 0;
+}
@@ -0,0 +1,182 @@
+// std
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <string>
+// CoreTime
+#include "ClockSource.h"
+#include "Stopwatch.h"
+#include "TimeSpan.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+using namespace std::chrono;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr size_t k_calls   = 1024;
+constexpr int    k_steps   = 32;
+constexpr int    k_samples = 1000;
+
+//------------------------------------------------------------------------------
+time_t system_clock_ticks()
+{
+    return duration_cast<TimeSpan::duration_t>(
+        system_clock::now().time_since_epoch()
+    ).count();
+}
+
+//------------------------------------------------------------------------------
+time_t steady_clock_ticks()
+{
+    return duration_cast<TimeSpan::duration_t>(
+        steady_clock::now().time_since_epoch()
+    ).count();
+}
+
+//------------------------------------------------------------------------------
+// The smallest step the clock is seen to advance by, in nanoseconds.
+template <typename TRead>
+double measure_granularity(TRead read)
+{
+    auto best = time_t(-1);
+    for(int i = 0; i < k_steps; ++i)
+    {
+        auto before = read();
+        auto after  = read();
+        while(after == before)
+            after = read();
+
+        if(best < 0 || after - before < best)
+            best = (after - before);
+    }
+
+    return double(best * 100);
+}
+
+//------------------------------------------------------------------------------
+// The largest distance from CLOCK_REALTIME, in nanoseconds, over ~1s of
+// samples - Long enough to span a resynchronization of Tsc.
+template <typename TRead>
+double measure_max_offset(TRead read)
+{
+    auto worst = 0.0;
+    for(int i = 0; i < k_samples; ++i)
+    {
+        auto before = ClockSource::Realtime::UtcTicks();
+        auto value  = read();
+        auto after  = ClockSource::Realtime::UtcTicks();
+
+        auto offset = double(value) - (double(before) + double(after)) / 2.0;
+        worst = std::max(worst, (offset < 0) ? -offset : offset);
+
+        struct timespec _timespec = {0, 1000 * 1000};
+        nanosleep(&_timespec, nullptr);
+    }
+
+    return worst * 100.0;
+}
+
+//------------------------------------------------------------------------------
+template <typename TRead>
+void bench_clock(const Bench &bench, const std::string &impl, TRead read)
+{
+    bench.Run("Read", impl, k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+            Bench::DoNotOptimize(read());
+    });
+
+    bench.Report("Read", impl, "granularity_ns", measure_granularity(read));
+}
+
+//------------------------------------------------------------------------------
+template <typename TClock>
+void bench_stopwatch(const Bench &bench, const std::string &impl)
+{
+    auto stopwatch = Stopwatch<TClock>();
+    bench.Run("StopwatchStartStop", impl, k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+        {
+            stopwatch.Start();
+            stopwatch.Stop();
+        }
+        Bench::DoNotOptimize(stopwatch);
+    });
+
+    bench.Run("StopwatchElapsedTicks", impl, k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+            Bench::DoNotOptimize(stopwatch.ElapsedTicks());
+    });
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Benchmarks                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Cost of a read and the smallest step of each clock.
+void bench_read(const Bench &bench)
+{
+    bench_clock(bench, "Realtime",       []() { return ClockSource::Realtime      ::UtcTicks(); });
+    bench_clock(bench, "RealtimeCoarse", []() { return ClockSource::RealtimeCoarse::UtcTicks(); });
+    bench_clock(bench, "Tsc",            []() { return ClockSource::Tsc           ::UtcTicks(); });
+    bench_clock(bench, "std_chrono_system_clock", system_clock_ticks);
+    bench_clock(bench, "std_chrono_steady_clock", steady_clock_ticks);
+
+    //--------------------------------------------------------------------------
+    // The raw counter, before scaling it to ticks.
+    bench.Run("ReadCounter", "Tsc", k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+            Bench::DoNotOptimize(ClockSource::Tsc::ReadCounter());
+    });
+}
+
+//------------------------------------------------------------------------------
+// A Start and a Stop are two reads of the clock.
+void bench_stopwatches(const Bench &bench)
+{
+    bench_stopwatch<StopwatchClock::Monotonic>(bench, "Monotonic");
+    bench_stopwatch<StopwatchClock::Tsc>      (bench, "Tsc");
+}
+
+//------------------------------------------------------------------------------
+// How far the wall clocks get from CLOCK_REALTIME.
+void bench_offset(const Bench &bench)
+{
+    bench.Report("Offset", "RealtimeCoarse", "max_offset_ns", measure_max_offset(
+        []() { return ClockSource::RealtimeCoarse::UtcTicks(); }
+    ));
+    bench.Report("Offset", "Tsc", "max_offset_ns", measure_max_offset(
+        []() { return ClockSource::Tsc::UtcTicks(); }
+    ));
+    bench.Report("Offset", "std_chrono_system_clock", "max_offset_ns", measure_max_offset(
+        system_clock_ticks
+    ));
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int main()
+{
+    auto bench = Bench("Clock");
+
+    Bench::PrintHeader();
+    bench.Report("Tsc", "Tsc", "is_reliable", double(ClockSource::Tsc::WarmUp()));
+
+    bench_read       (bench);
+    bench_stopwatches(bench);
+    bench_offset     (bench);
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+// std
+#include <cstdint>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+// CoreTime
+#include "CompressedTickSeries.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr size_t k_random_reads = 4096;
+
+//------------------------------------------------------------------------------
+// One value per second - A sensor sampled at a fixed rate.
+std::vector<time_t> make_regular(size_t count)
+{
+    auto first = DateTime(2020, 1, 1, 0, 0, 0, 0).Ticks();
+
+    auto ticks = std::vector<time_t>(count);
+    for(size_t i = 0; i < count; ++i)
+        ticks[i] = first + time_t(i) * TimeSpan::TicksPerSecond;
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+// One value per second with +/-1ms of jitter - The same sensor read by a
+// loaded scheduler.
+std::vector<time_t> make_jittered(size_t count)
+{
+    auto rng    = std::mt19937_64(42);
+    auto jitter = std::uniform_int_distribution<time_t>(
+        -TimeSpan::TicksPerMillisecond, TimeSpan::TicksPerMillisecond
+    );
+    auto first  = DateTime(2020, 1, 1, 0, 0, 0, 0).Ticks();
+
+    auto ticks = std::vector<time_t>(count);
+    for(size_t i = 0; i < count; ++i)
+        ticks[i] = first + time_t(i) * TimeSpan::TicksPerSecond + jitter(rng);
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+void bench_series(
+    const Bench               &bench,
+    const std::string         &caseName,
+    const std::vector<time_t> &ticks)
+{
+    auto count  = ticks.size();
+    auto series = CompressedTickSeries();
+    for(auto value : ticks)
+        series.Append(value);
+
+    //--------------------------------------------------------------------------
+    // Size - Against the 8 bytes of each raw value.
+    auto raw_bytes = double(count * sizeof(time_t));
+    bench.Report(caseName, "CoreTime", "compression_ratio", raw_bytes / double(series.ByteSize()));
+    bench.Report(caseName, "CoreTime", "bits_per_value",    double(series.ByteSize()) * 8.0 / double(count));
+
+    //--------------------------------------------------------------------------
+    // Append - From an empty series each time.
+    bench.Run(caseName + "_Append", "CoreTime", count, [&]() {
+        auto appended = CompressedTickSeries();
+        for(auto value : ticks)
+            appended.Append(value);
+        Bench::DoNotOptimize(appended.ByteSize());
+    });
+
+    //--------------------------------------------------------------------------
+    // Decode - GB/s are of the decoded 8 byte ticks. The memcpy of the raw
+    // ticks is the ceiling.
+    auto decoded = std::vector<time_t>(count);
+    auto decode_ns = bench.Run(caseName + "_Decode", "CoreTime", count, [&]() {
+        series.Decode(0, decoded);
+        Bench::DoNotOptimize(decoded.data());
+    });
+    bench.Report(caseName + "_Decode", "CoreTime", "decode_gb_per_s", double(sizeof(time_t)) / decode_ns);
+
+    auto copy_ns = bench.Run(caseName + "_Decode", "memcpy_raw", count, [&]() {
+        decoded.assign(ticks.begin(), ticks.end());
+        Bench::DoNotOptimize(decoded.data());
+    });
+    bench.Report(caseName + "_Decode", "memcpy_raw", "decode_gb_per_s", double(sizeof(time_t)) / copy_ns);
+
+    //--------------------------------------------------------------------------
+    // At - Random access decodes from the start of the value's block.
+    auto rng     = std::mt19937_64(7);
+    auto indexes = std::vector<size_t>(k_random_reads);
+    for(auto &index : indexes)
+        index = size_t(rng() % count);
+
+    bench.Run(caseName + "_At", "CoreTime", k_random_reads, [&]() {
+        for(auto index : indexes)
+            Bench::DoNotOptimize(series.At(index));
+    });
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Usage: BenchCompression [count] - 4M values by default.
+int main(int argc, char *argv[])
+{
+    auto count = (argc > 1) ? size_t(std::stoull(argv[1])) : size_t(1) << 22;
+    auto bench = Bench("Compression");
+
+    Bench::PrintHeader();
+    bench.Report("Input", "All", "values", double(count));
+
+    bench_series(bench, "Regular",  make_regular (count));
+    bench_series(bench, "Jittered", make_jittered(count));
+
+    return 0;
+}
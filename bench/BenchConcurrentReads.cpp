@@ -0,0 +1,127 @@
+// std
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <latch>
+#include <string>
+#include <thread>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "TimeSpan.h"
+#include "TimeZone.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr size_t k_reads = 1 << 20;
+
+//------------------------------------------------------------------------------
+// Runs read on threadCount threads at once, k_reads times on each, and
+// reports the total reads per second - Best of Bench::Repetitions.
+template <typename TRead>
+void bench_threads(
+    const Bench       &bench,
+    const std::string &impl,
+    unsigned           threadCount,
+    TRead              read)
+{
+    auto best = 0.0;
+    for(int repetition = 0; repetition < Bench::Repetitions; ++repetition)
+    {
+        auto ready   = std::latch(threadCount + 1);
+        auto threads = std::vector<std::thread>();
+        for(unsigned t = 0; t < threadCount; ++t)
+        {
+            threads.emplace_back([&]() {
+                ready.arrive_and_wait();
+                for(size_t i = 0; i < k_reads; ++i)
+                    Bench::DoNotOptimize(read(i));
+            });
+        }
+
+        auto start = Bench::steady_clock_t::now();
+        ready.arrive_and_wait();
+        for(auto &thread : threads)
+            thread.join();
+
+        auto seconds = std::chrono::duration<double>(Bench::steady_clock_t::now() - start).count();
+        best = std::max(best, double(k_reads) * threadCount / seconds);
+    }
+
+    bench.Report("Read_" + std::to_string(threadCount) + "_threads", impl, "reads_per_s", best);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Usage: BenchConcurrentReads [threads] - From 1 to the hardware
+// concurrency by default.
+//
+// Every thread reads Year(), Month() and Fields() of the same const
+// DateTimes - With no shared writes they should scale with the cores.
+// localtime_r is the libc equivalent of the Local reads.
+int main(int argc, char *argv[])
+{
+    auto max_threads = (argc > 1)
+        ? unsigned(std::stoul(argv[1]))
+        : std::max(1u, std::thread::hardware_concurrency());
+    auto bench = Bench("ConcurrentReads");
+
+    Bench::PrintHeader();
+    bench.Report("Input", "All", "max_threads", double(max_threads));
+
+    //--------------------------------------------------------------------------
+    // A few days of nearby values, like the timestamps of a log.
+    auto first   = DateTime(2024, 6, 15, 0, 0, 0, 0).Ticks();
+    auto utc     = std::vector<DateTime>();
+    auto local   = std::vector<DateTime>();
+    auto seconds = std::vector<time_t>();
+    for(time_t i = 0; i < 1024; ++i)
+    {
+        auto ticks = first + i * 337 * TimeSpan::TicksPerSecond;
+        utc    .push_back(DateTime(ticks, DateTime::DateTimeKind::UTC));
+        local  .push_back(DateTime(ticks, DateTime::DateTimeKind::Local));
+        seconds.push_back(ticks / TimeSpan::TicksPerSecond);
+    }
+
+    //--------------------------------------------------------------------------
+    // The zone is loaded before timing - The readers only race its lookups.
+    TimeZone::Local();
+
+    const auto &shared_utc   = utc;
+    const auto &shared_local = local;
+
+    for(unsigned threads = 1; threads <= max_threads; ++threads)
+    {
+        bench_threads(bench, "CoreTime_Utc", threads, [&](size_t i) {
+            const auto &dateTime = shared_utc[i % 1024];
+            return dateTime.Year() + dateTime.Month() + dateTime.Fields().hour;
+        });
+
+        bench_threads(bench, "CoreTime_Local", threads, [&](size_t i) {
+            const auto &dateTime = shared_local[i % 1024];
+            return dateTime.Year() + dateTime.Month() + dateTime.Fields().hour;
+        });
+
+        bench_threads(bench, "libc_localtime_r", threads, [&](size_t i) {
+            auto fields = tm{};
+            localtime_r(&seconds[i % 1024], &fields);
+            return fields.tm_hour;
+        });
+    }
+
+    return 0;
+}
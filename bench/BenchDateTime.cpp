@@ -0,0 +1,366 @@
+// std
+#include <chrono>
+#include <ctime>
+#include <random>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "DecomposedDateTime.h"
+#include "TimeSpan.h"
+#include "TimeUnit.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+using namespace std::chrono;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr size_t k_count = 4096;
+
+typedef TimeSpan::duration_t ticks_t;
+typedef DateTime::sys_time_t time_point_t;
+
+//------------------------------------------------------------------------------
+// UTC DateTimes spread over 1900-2100.
+std::vector<DateTime> make_date_times()
+{
+    auto first = DateTime(1900, 1, 1, 0, 0, 0, 0).Ticks();
+    auto last  = DateTime(2100, 1, 1, 0, 0, 0, 0).Ticks();
+
+    auto rng          = std::mt19937_64(42);
+    auto distribution = std::uniform_int_distribution<time_t>(first, last);
+
+    auto dateTimes = std::vector<DateTime>();
+    for(size_t i = 0; i < k_count; ++i)
+        dateTimes.push_back(DateTime(distribution(rng)));
+
+    return dateTimes;
+}
+
+//------------------------------------------------------------------------------
+// std::chrono has no AddMonths - The day is clamped like DateTime does.
+time_point_t chrono_add_months(time_point_t timePoint, int count)
+{
+    auto day   = floor<days>(timePoint);
+    auto date  = year_month_day(day) + months(count);
+    if(!date.ok())
+        date = date.year() / date.month() / last;
+
+    return sys_days(date) + (timePoint - day);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Benchmarks                                                                 //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void bench_decompose(const Bench &bench, const std::vector<DateTime> &dateTimes)
+{
+    //--------------------------------------------------------------------------
+    // Cold - Every DateTime is decomposed from its ticks.
+    bench.Run("DecomposeCold", "CoreTime", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+        {
+            auto fields = dateTime.Fields();
+            Bench::DoNotOptimize(fields);
+        }
+    });
+
+    bench.Run("DecomposeCold", "std_chrono", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+        {
+            auto time_point = dateTime.ToSysTime();
+            auto day        = floor<days>(time_point);
+            auto date       = year_month_day(day);
+            auto time       = hh_mm_ss<ticks_t>(time_point - day);
+            Bench::DoNotOptimize(date);
+            Bench::DoNotOptimize(time);
+        }
+    });
+
+    bench.Run("DecomposeCold", "libc_gmtime_r", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+        {
+            auto seconds = time_t(dateTime.Ticks() / TimeSpan::TicksPerSecond);
+            auto fields  = tm{};
+            gmtime_r(&seconds, &fields);
+            Bench::DoNotOptimize(fields);
+        }
+    });
+
+    //--------------------------------------------------------------------------
+    // Cached - The fields are computed once and read several times.
+    auto decomposed = std::vector<DecomposedDateTime>();
+    auto dates      = std::vector<year_month_day>();
+    auto times      = std::vector<hh_mm_ss<ticks_t>>();
+    for(const auto &dateTime : dateTimes)
+    {
+        auto time_point = dateTime.ToSysTime();
+        auto day        = floor<days>(time_point);
+
+        decomposed.push_back(DecomposedDateTime(dateTime));
+        dates     .push_back(year_month_day(day));
+        times     .push_back(hh_mm_ss<ticks_t>(time_point - day));
+    }
+
+    bench.Run("DecomposeCached", "CoreTime", k_count, [&]() {
+        auto sum = time_t(0);
+        for(const auto &dateTime : decomposed)
+            sum += dateTime.Year() + dateTime.Month() + dateTime.Day() + dateTime.Hour();
+        Bench::DoNotOptimize(sum);
+    });
+
+    bench.Run("DecomposeCached", "std_chrono", k_count, [&]() {
+        auto sum = time_t(0);
+        for(size_t i = 0; i < k_count; ++i)
+        {
+            sum += int     (dates[i].year ())
+                 + unsigned(dates[i].month())
+                 + unsigned(dates[i].day  ())
+                 + times[i].hours().count();
+        }
+        Bench::DoNotOptimize(sum);
+    });
+}
+
+//------------------------------------------------------------------------------
+void bench_compose(const Bench &bench, const std::vector<DateTime> &dateTimes)
+{
+    auto fields = std::vector<CivilFields>();
+    for(const auto &dateTime : dateTimes)
+        fields.push_back(dateTime.Fields());
+
+    bench.Run("Compose", "CoreTime", k_count, [&]() {
+        for(const auto &f : fields)
+        {
+            auto dateTime = DateTime(
+                f.year, f.month, f.day, f.hour, f.minute, f.second, f.millisecond
+            );
+            Bench::DoNotOptimize(dateTime);
+        }
+    });
+
+    bench.Run("Compose", "std_chrono", k_count, [&]() {
+        for(const auto &f : fields)
+        {
+            auto time_point = sys_days(year(int(f.year)) / int(f.month) / int(f.day))
+                            + hours       (f.hour)
+                            + minutes     (f.minute)
+                            + seconds     (f.second)
+                            + milliseconds(f.millisecond);
+            Bench::DoNotOptimize(time_point);
+        }
+    });
+
+    bench.Run("Compose", "libc_timegm", k_count, [&]() {
+        for(const auto &f : fields)
+        {
+            auto value    = tm{};
+            value.tm_year = int(f.year - 1900);
+            value.tm_mon  = int(f.month - 1);
+            value.tm_mday = int(f.day);
+            value.tm_hour = int(f.hour);
+            value.tm_min  = int(f.minute);
+            value.tm_sec  = int(f.second);
+
+            auto ticks = time_t(timegm(&value)) * TimeSpan::TicksPerSecond
+                       + f.millisecond * TimeSpan::TicksPerMillisecond;
+            Bench::DoNotOptimize(ticks);
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+void bench_add_calendar(const Bench &bench, const std::vector<DateTime> &dateTimes)
+{
+    bench.Run("AddMonths", "CoreTime", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(dateTime.AddMonths(7));
+    });
+
+    bench.Run("AddMonths", "std_chrono", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(chrono_add_months(dateTime.ToSysTime(), 7));
+    });
+
+    bench.Run("AddYears", "CoreTime", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(dateTime.AddYears(3));
+    });
+
+    bench.Run("AddYears", "std_chrono", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(chrono_add_months(dateTime.ToSysTime(), 3 * 12));
+    });
+}
+
+//------------------------------------------------------------------------------
+// The double based Add* methods against adding a std::chrono duration of
+// doubles rounded to ticks, and the integer TimeUnit overloads against
+// the std::chrono integer durations.
+template <typename TChronoPeriod, typename TAdd>
+void bench_add_double(
+    const Bench                 &bench,
+    const std::vector<DateTime> &dateTimes,
+    const std::string           &caseName,
+    TAdd                         add)
+{
+    bench.Run(caseName, "CoreTime", k_count, [&]() {
+        auto amount = 1.5;
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(add(dateTime, amount));
+    });
+
+    bench.Run(caseName, "std_chrono", k_count, [&]() {
+        auto amount = duration<double, TChronoPeriod>(1.5);
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(dateTime.ToSysTime() + round<ticks_t>(amount));
+    });
+}
+
+//------------------------------------------------------------------------------
+void bench_add(const Bench &bench, const std::vector<DateTime> &dateTimes)
+{
+    bench_add_double<days::period>(bench, dateTimes, "AddDays",
+        [](const DateTime &dateTime, double value) { return dateTime.AddDays(value); });
+    bench_add_double<hours::period>(bench, dateTimes, "AddHours",
+        [](const DateTime &dateTime, double value) { return dateTime.AddHours(value); });
+    bench_add_double<minutes::period>(bench, dateTimes, "AddMinutes",
+        [](const DateTime &dateTime, double value) { return dateTime.AddMinutes(value); });
+    bench_add_double<seconds::period>(bench, dateTimes, "AddSeconds",
+        [](const DateTime &dateTime, double value) { return dateTime.AddSeconds(value); });
+    bench_add_double<milliseconds::period>(bench, dateTimes, "AddMilliseconds",
+        [](const DateTime &dateTime, double value) { return dateTime.AddMilliseconds(value); });
+
+    bench.Run("AddTicks", "CoreTime", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(dateTime.AddTicks(12345));
+    });
+
+    bench.Run("AddTicks", "std_chrono", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(dateTime.ToSysTime() + ticks_t(12345));
+    });
+
+    bench.Run("AddDaysUnit", "CoreTime", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(dateTime.Add(Days(3)));
+    });
+
+    bench.Run("AddDaysUnit", "std_chrono", k_count, [&]() {
+        for(const auto &dateTime : dateTimes)
+            Bench::DoNotOptimize(dateTime.ToSysTime() + days(3));
+    });
+}
+
+//------------------------------------------------------------------------------
+void bench_now(const Bench &bench)
+{
+    constexpr size_t k_calls = 256;
+
+    bench.Run("UtcNow", "CoreTime", k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+            Bench::DoNotOptimize(DateTime::UtcNow());
+    });
+
+    bench.Run("Now", "CoreTime", k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+            Bench::DoNotOptimize(DateTime::Now());
+    });
+
+    bench.Run("UtcNow", "std_chrono", k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+            Bench::DoNotOptimize(system_clock::now());
+    });
+
+    //--------------------------------------------------------------------------
+    // Now on its own only relabels the ticks - Reading the local wall
+    // clock is where the time zone is used.
+    bench.Run("NowHour", "CoreTime", k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+            Bench::DoNotOptimize(DateTime::Now().Hour());
+    });
+
+    bench.Run("NowHour", "libc_localtime_r", k_calls, [&]() {
+        for(size_t i = 0; i < k_calls; ++i)
+        {
+            auto seconds = system_clock::to_time_t(system_clock::now());
+            auto fields  = tm{};
+            localtime_r(&seconds, &fields);
+            Bench::DoNotOptimize(fields.tm_hour);
+        }
+    });
+}
+
+//------------------------------------------------------------------------------
+void bench_time_span(const Bench &bench, const std::vector<DateTime> &dateTimes)
+{
+    auto values = std::vector<time_t>();
+    for(const auto &dateTime : dateTimes)
+        values.push_back(dateTime.Ticks() % TimeSpan::TicksPerDay);
+
+    bench.Run("TimeSpanFromTicks", "CoreTime", k_count, [&]() {
+        auto sum = time_t(0);
+        for(auto value : values)
+        {
+            auto timeSpan = TimeSpan(value);
+            Bench::DoNotOptimize(timeSpan);
+            sum += timeSpan.Ticks();
+        }
+        Bench::DoNotOptimize(sum);
+    });
+
+    bench.Run("TimeSpanFromTicks", "std_chrono", k_count, [&]() {
+        auto sum = time_t(0);
+        for(auto value : values)
+        {
+            auto duration = ticks_t(value);
+            Bench::DoNotOptimize(duration);
+            sum += duration.count();
+        }
+        Bench::DoNotOptimize(sum);
+    });
+
+    bench.Run("TimeSpanFromDays", "CoreTime", k_count, [&]() {
+        for(auto value : values)
+            Bench::DoNotOptimize(TimeSpan(value % 64, 1, 2, 3, 4));
+    });
+
+    bench.Run("TimeSpanFromDays", "std_chrono", k_count, [&]() {
+        for(auto value : values)
+        {
+            auto duration = ticks_t(days(value % 64) + hours(1) + minutes(2)
+                                  + seconds(3) + milliseconds(4));
+            Bench::DoNotOptimize(duration);
+        }
+    });
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    auto bench     = Bench("DateTime");
+    auto dateTimes = make_date_times();
+
+    Bench::PrintHeader();
+    bench_decompose   (bench, dateTimes);
+    bench_compose     (bench, dateTimes);
+    bench_add_calendar(bench, dateTimes);
+    bench_add         (bench, dateTimes);
+    bench_now         (bench);
+    bench_time_span   (bench, dateTimes);
+
+    return 0;
+}
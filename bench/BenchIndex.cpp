@@ -0,0 +1,164 @@
+// std
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "TimeIndex.h"
+#include "TimeSpan.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr size_t k_query_count = 1 << 16;
+
+//------------------------------------------------------------------------------
+// One value per second with up to 1ms of jitter - A sensor sampled at a
+// fixed rate, the best case of Model::PiecewiseLinear.
+std::vector<time_t> make_even_ticks(size_t count)
+{
+    auto rng    = std::mt19937_64(42);
+    auto jitter = std::uniform_int_distribution<time_t>(0, TimeSpan::TicksPerMillisecond);
+    auto first  = DateTime(2020, 1, 1, 0, 0, 0, 0).Ticks();
+
+    auto ticks = std::vector<time_t>(count);
+    for(size_t i = 0; i < count; ++i)
+        ticks[i] = first + time_t(i) * TimeSpan::TicksPerSecond + jitter(rng);
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+// Bursts of values 1ms apart separated by idle gaps of up to an hour -
+// Events, the worst case of Model::PiecewiseLinear.
+std::vector<time_t> make_bursty_ticks(size_t count)
+{
+    auto rng   = std::mt19937_64(42);
+    auto burst = std::uniform_int_distribution<size_t>(1, 256);
+    auto gap   = std::uniform_int_distribution<time_t>(0, TimeSpan::TicksPerHour);
+    auto value = DateTime(2020, 1, 1, 0, 0, 0, 0).Ticks();
+
+    auto ticks = std::vector<time_t>();
+    ticks.reserve(count);
+    while(ticks.size() < count)
+    {
+        value += gap(rng);
+        for(auto n = burst(rng); n > 0 && ticks.size() < count; --n)
+        {
+            ticks.push_back(value);
+            value += TimeSpan::TicksPerMillisecond;
+        }
+    }
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+// Uniform over the span of the values, plus a few past both ends.
+std::vector<time_t> make_queries(const std::vector<time_t> &ticks)
+{
+    auto margin       = (ticks.back() - ticks.front()) / 64;
+    auto rng          = std::mt19937_64(7);
+    auto distribution = std::uniform_int_distribution<time_t>(
+        ticks.front() - margin, ticks.back() + margin
+    );
+
+    auto queries = std::vector<time_t>(k_query_count);
+    for(auto &query : queries)
+        query = distribution(rng);
+
+    return queries;
+}
+
+//------------------------------------------------------------------------------
+template <typename TLowerBound>
+void bench_lower_bound(
+    const Bench               &bench,
+    const std::string         &caseName,
+    const std::string         &impl,
+    const std::vector<time_t> &queries,
+    TLowerBound                lowerBound)
+{
+    bench.Run(caseName, impl, queries.size(), [&]() {
+        for(auto query : queries)
+            Bench::DoNotOptimize(lowerBound(query));
+    });
+}
+
+//------------------------------------------------------------------------------
+void bench_index(
+    const Bench               &bench,
+    const std::string         &caseName,
+    const std::vector<time_t> &ticks)
+{
+    auto queries = make_queries(ticks);
+
+    bench_lower_bound(bench, caseName, "std_lower_bound", queries, [&](time_t query) {
+        return size_t(std::lower_bound(ticks.begin(), ticks.end(), query) - ticks.begin());
+    });
+
+    auto models = {
+        std::make_pair(TimeIndex::Model::Eytzinger,       std::string("CoreTime_Eytzinger")),
+        std::make_pair(TimeIndex::Model::PiecewiseLinear, std::string("CoreTime_PiecewiseLinear"))
+    };
+
+    for(const auto &[model, impl] : models)
+    {
+        auto index = TimeIndex(ticks, model);
+
+        bench.Report(caseName, impl, "index_bytes_per_value",
+            double(index.ByteSize()) / double(ticks.size())
+        );
+        bench_lower_bound(bench, caseName, impl, queries, [&](time_t query) {
+            return index.LowerBound(query);
+        });
+    }
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Usage: BenchIndex [count] - 16M values by default. The sizes grow from
+// 64K (in the L2 cache) to count (well past the LLC).
+int main(int argc, char *argv[])
+{
+    auto count = (argc > 1) ? size_t(std::stoull(argv[1])) : size_t(1) << 24;
+    auto bench = Bench("Index");
+
+    Bench::PrintHeader();
+    bench.Report("Input", "All", "values",  double(count));
+    bench.Report("Input", "All", "queries", double(k_query_count));
+
+    //--------------------------------------------------------------------------
+    // 64K, 1M, 16M... and count itself.
+    auto sizes = std::vector<size_t>();
+    for(auto size = size_t(1) << 16; size < count; size *= 16)
+        sizes.push_back(size);
+    sizes.push_back(count);
+
+    for(auto size : sizes)
+    {
+        auto suffix = "_" + std::to_string(size);
+
+        bench_index(bench, "LowerBound_Even"   + suffix, make_even_ticks  (size));
+        bench_index(bench, "LowerBound_Bursty" + suffix, make_bursty_ticks(size));
+    }
+
+    return 0;
+}
@@ -0,0 +1,133 @@
+// std
+#include <algorithm>
+#include <ctime>
+#include <random>
+#include <string>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// The layout of DateTime before it was packed in 8 bytes - The ticks, the
+// kind and the mutable cache of the decomposed fields.
+struct LegacyDateTime
+{
+    time_t                 m_ticksSinceUnixEpoch;
+    DateTime::DateTimeKind m_kind;
+    mutable tm             m_tm;
+    mutable bool           m_tmIsDirty;
+
+    bool operator <(const LegacyDateTime &rhs) const
+    {
+        return m_ticksSinceUnixEpoch < rhs.m_ticksSinceUnixEpoch;
+    }
+};
+
+//------------------------------------------------------------------------------
+std::vector<time_t> make_ticks(size_t count)
+{
+    auto first = DateTime(2000, 1, 1, 0, 0, 0, 0).Ticks();
+    auto last  = DateTime(2030, 1, 1, 0, 0, 0, 0).Ticks();
+
+    auto rng          = std::mt19937_64(42);
+    auto distribution = std::uniform_int_distribution<time_t>(first, last);
+
+    auto ticks = std::vector<time_t>(count);
+    for(auto &value : ticks)
+        value = distribution(rng);
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+template <typename TValue, typename TMake, typename TTicks>
+void bench_layout(
+    const Bench               &bench,
+    const std::string         &impl,
+    const std::vector<time_t> &ticks,
+    TMake                      make,
+    TTicks                     ticksOf)
+{
+    auto count  = ticks.size();
+    auto values = std::vector<TValue>();
+    values.reserve(count);
+
+    bench.Report("Layout", impl, "bytes_per_value", double(sizeof(TValue)));
+
+    //--------------------------------------------------------------------------
+    // Sort - Every repetition starts from the same shuffled values.
+    bench.RunWithSetup("Sort", impl, count,
+        [&]() {
+            values.clear();
+            for(auto value : ticks)
+                values.push_back(make(value));
+        },
+        [&]() { std::sort(values.begin(), values.end()); }
+    );
+
+    //--------------------------------------------------------------------------
+    // Scan - Count and sum the values of a time window.
+    auto from = DateTime(2010, 1, 1, 0, 0, 0, 0).Ticks();
+    auto to   = DateTime(2020, 1, 1, 0, 0, 0, 0).Ticks();
+
+    bench.Run("Scan", impl, count, [&]() {
+        auto matches = size_t(0);
+        auto sum     = time_t(0);
+        for(const auto &value : values)
+        {
+            auto value_ticks = ticksOf(value);
+            auto in_window   = (value_ticks >= from && value_ticks < to);
+
+            matches += in_window;
+            sum     += in_window ? value_ticks : 0;
+        }
+        Bench::DoNotOptimize(matches);
+        Bench::DoNotOptimize(sum);
+    });
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Usage: BenchLayout [count] - 4M values by default.
+int main(int argc, char *argv[])
+{
+    auto count = (argc > 1) ? size_t(std::stoull(argv[1])) : size_t(1) << 22;
+    auto bench = Bench("Layout");
+    auto ticks = make_ticks(count);
+
+    Bench::PrintHeader();
+    bench.Report("Input", "All", "values", double(count));
+
+    bench_layout<LegacyDateTime>(bench, "Before_80_bytes", ticks,
+        [](time_t ticks) {
+            auto value                  = LegacyDateTime{};
+            value.m_ticksSinceUnixEpoch = ticks;
+            value.m_kind                = DateTime::DateTimeKind::UTC;
+            value.m_tmIsDirty           = true;
+            return value;
+        },
+        [](const LegacyDateTime &value) { return value.m_ticksSinceUnixEpoch; }
+    );
+
+    bench_layout<DateTime>(bench, "CoreTime", ticks,
+        [](time_t ticks) { return DateTime(ticks); },
+        [](const DateTime &value) { return value.Ticks(); }
+    );
+
+    return 0;
+}
@@ -0,0 +1,159 @@
+// std
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "TimeSpan.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr size_t k_count = 1024;
+
+//------------------------------------------------------------------------------
+// Random instants of 2000 to 2030 written as the layouts of logs and APIs -
+// With a 7 digits fraction and an offset if withFraction is set.
+std::vector<std::string> make_strings(bool withFraction)
+{
+    auto rng          = std::mt19937_64(42);
+    auto distribution = std::uniform_int_distribution<time_t>(
+        DateTime(2000, 1, 1, 0, 0, 0, 0).Ticks(), DateTime(2030, 1, 1, 0, 0, 0, 0).Ticks() - 1
+    );
+
+    auto strings = std::vector<std::string>();
+    for(size_t i = 0; i < k_count; ++i)
+    {
+        auto dateTime = DateTime(distribution(rng));
+        auto fields   = dateTime.Fields();
+
+        char buffer[64];
+        auto size = std::snprintf(
+            buffer, sizeof(buffer), "%04d-%02d-%02dT%02d:%02d:%02d",
+            int(fields.year), int(fields.month), int(fields.day),
+            int(fields.hour), int(fields.minute), int(fields.second)
+        );
+        if(withFraction)
+        {
+            std::snprintf(
+                buffer + size, sizeof(buffer) - size, ".%07d%c%02d:%02d",
+                int(dateTime.Ticks() % TimeSpan::TicksPerSecond),
+                (i % 2 == 0) ? '+' : '-', int(i % 14), int((i % 4) * 15)
+            );
+        }
+
+        strings.push_back(buffer);
+    }
+
+    return strings;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Usage: BenchParse
+//
+// strptime and std::get_time don't read fractions nor offsets, so they only
+// run the seconds layout - And need a timegm to give an instant.
+// std::chrono::parse runs where the standard library has it.
+int main()
+{
+    auto bench = Bench("Parse");
+
+    Bench::PrintHeader();
+    bench.Report("Input", "All", "strings", double(k_count));
+
+    //--------------------------------------------------------------------------
+    // YYYY-MM-DDThh:mm:ss
+    auto seconds = make_strings(false);
+
+    bench.Run("Seconds", "CoreTime_TryParse", k_count, [&]() {
+        auto result = DateTime(0);
+        for(const auto &str : seconds)
+        {
+            DateTime::TryParse(str, result);
+            Bench::DoNotOptimize(result);
+        }
+    });
+
+    bench.Run("Seconds", "libc_strptime", k_count, [&]() {
+        for(const auto &str : seconds)
+        {
+            auto fields = tm{};
+            strptime(str.c_str(), "%Y-%m-%dT%H:%M:%S", &fields);
+            Bench::DoNotOptimize(timegm(&fields));
+        }
+    });
+
+    bench.Run("Seconds", "std_get_time", k_count, [&]() {
+        auto stream = std::istringstream();
+        for(const auto &str : seconds)
+        {
+            auto fields = tm{};
+            stream.clear();
+            stream.str(str);
+            stream >> std::get_time(&fields, "%Y-%m-%dT%H:%M:%S");
+            Bench::DoNotOptimize(timegm(&fields));
+        }
+    });
+
+#if __cpp_lib_chrono >= 201907L
+    bench.Run("Seconds", "std_chrono_parse", k_count, [&]() {
+        auto stream = std::istringstream();
+        for(const auto &str : seconds)
+        {
+            auto timePoint = std::chrono::sys_seconds();
+            stream.clear();
+            stream.str(str);
+            stream >> std::chrono::parse("%FT%T", timePoint);
+            Bench::DoNotOptimize(timePoint);
+        }
+    });
+#endif
+
+    //--------------------------------------------------------------------------
+    // YYYY-MM-DDThh:mm:ss.fffffff+hh:mm
+    auto fractions = make_strings(true);
+
+    bench.Run("Fraction_Offset", "CoreTime_TryParse", k_count, [&]() {
+        auto result = DateTime(0);
+        for(const auto &str : fractions)
+        {
+            DateTime::TryParse(str, result);
+            Bench::DoNotOptimize(result);
+        }
+    });
+
+#if __cpp_lib_chrono >= 201907L
+    bench.Run("Fraction_Offset", "std_chrono_parse", k_count, [&]() {
+        auto stream = std::istringstream();
+        for(const auto &str : fractions)
+        {
+            auto timePoint = DateTime::sys_time_t();
+            stream.clear();
+            stream.str(str);
+            stream >> std::chrono::parse("%FT%T%Ez", timePoint);
+            Bench::DoNotOptimize(timePoint);
+        }
+    });
+#endif
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+// std
+#include <algorithm>
+#include <cstdint>
+#include <ctime>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <unistd.h>
+// CoreTime
+#include "DateTime.h"
+#include "TimeSort.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Peak memory per value - The input, plus the pairs of the std baselines
+// with payloads and the buffer of their std::stable_sort.
+constexpr size_t k_bytes_per_value = 40;
+
+//------------------------------------------------------------------------------
+size_t physical_memory()
+{
+    return size_t(sysconf(_SC_PHYS_PAGES)) * size_t(sysconf(_SC_PAGE_SIZE));
+}
+
+//------------------------------------------------------------------------------
+// 1M, 100M, 1B... - The exact count otherwise.
+std::string count_name(size_t count)
+{
+    if(count % 1000000000 == 0) return std::to_string(count / 1000000000) + "B";
+    if(count % 1000000    == 0) return std::to_string(count / 1000000)    + "M";
+    if(count % 1000       == 0) return std::to_string(count / 1000)       + "K";
+
+    return std::to_string(count);
+}
+
+//------------------------------------------------------------------------------
+// Uniform ticks in [first, last) - The wider the range the more digits the
+// radix sort can't skip.
+std::vector<DateTime> make_values(size_t count, const DateTime &first, const DateTime &last)
+{
+    auto rng          = std::mt19937_64(42);
+    auto distribution = std::uniform_int_distribution<time_t>(
+        first.Ticks(), last.Ticks() - 1
+    );
+
+    auto values = std::vector<DateTime>();
+    values.reserve(count);
+    for(size_t i = 0; i < count; ++i)
+        values.push_back(DateTime(distribution(rng), DateTime::DateTimeKind::UTC));
+
+    return values;
+}
+
+//------------------------------------------------------------------------------
+// DateTimes alone - Every repetition starts from the same shuffled values.
+void bench_sort(
+    const Bench                 &bench,
+    const std::string           &caseName,
+    const std::vector<DateTime> &input)
+{
+    auto count  = input.size();
+    auto values = std::vector<DateTime>();
+    auto reset  = [&]() { values = input; };
+
+    bench.RunWithSetup(caseName, "std_sort", count, reset, [&]() {
+        std::sort(values.begin(), values.end());
+    });
+
+    bench.RunWithSetup(caseName, "std_stable_sort", count, reset, [&]() {
+        std::stable_sort(values.begin(), values.end());
+    });
+
+    bench.RunWithSetup(caseName, "CoreTime_SortByTime", count, reset, [&]() {
+        TimeSort::SortByTime(std::span(values));
+    });
+
+    bench.RunWithSetup(caseName, "CoreTime_ParallelSortByTime", count, reset, [&]() {
+        TimeSort::ParallelSortByTime(std::span(values));
+    });
+}
+
+//------------------------------------------------------------------------------
+// DateTimes with the index of their row - The std baselines sort pairs, as
+// there is no std way to permute a second array along the keys.
+void bench_sort_with_payload(
+    const Bench                 &bench,
+    const std::string           &caseName,
+    const std::vector<DateTime> &input)
+{
+    auto count = input.size();
+    auto by_key = [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; };
+
+    auto pairs       = std::vector<std::pair<DateTime, std::uint32_t>>();
+    auto reset_pairs = [&]() {
+        pairs.clear();
+        pairs.reserve(count);
+        for(size_t i = 0; i < count; ++i)
+            pairs.emplace_back(input[i], std::uint32_t(i));
+    };
+
+    bench.RunWithSetup(caseName, "std_sort", count, reset_pairs, [&]() {
+        std::sort(pairs.begin(), pairs.end(), by_key);
+    });
+
+    bench.RunWithSetup(caseName, "std_stable_sort", count, reset_pairs, [&]() {
+        std::stable_sort(pairs.begin(), pairs.end(), by_key);
+    });
+
+    auto keys     = std::vector<DateTime>();
+    auto payloads = std::vector<std::uint32_t>(count);
+    auto reset    = [&]() {
+        keys = input;
+        std::iota(payloads.begin(), payloads.end(), std::uint32_t(0));
+    };
+
+    bench.RunWithSetup(caseName, "CoreTime_SortByTime", count, reset, [&]() {
+        TimeSort::SortByTime(std::span(keys), std::span(payloads));
+    });
+
+    bench.RunWithSetup(caseName, "CoreTime_ParallelSortByTime", count, reset, [&]() {
+        TimeSort::ParallelSortByTime(std::span(keys), std::span(payloads));
+    });
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Usage: BenchSort [count...] - 1M, 100M and 1B values by default. Counts
+// that don't fit in the physical memory are reported as skipped.
+int main(int argc, char *argv[])
+{
+    auto counts = std::vector<size_t>();
+    for(int i = 1; i < argc; ++i)
+        counts.push_back(size_t(std::stoull(argv[i])));
+    if(counts.empty())
+        counts = { 1000000, 100000000, 1000000000 };
+
+    auto bench  = Bench("Sort");
+    auto memory = physical_memory();
+
+    Bench::PrintHeader();
+    bench.Report("Input", "Threads", "threads", double(std::thread::hardware_concurrency()));
+    bench.Report("Input", "Memory",  "bytes",   double(memory));
+
+    for(auto count : counts)
+    {
+        if(count > memory / k_bytes_per_value)
+        {
+            bench.Report("Input", "Skipped", "values", double(count));
+            continue;
+        }
+
+        bench.Report("Input", "All", "values", double(count));
+        auto suffix = "_" + count_name(count);
+
+        //----------------------------------------------------------------------
+        // Thirty years of ticks against a single day of them - The later
+        // leaves the radix sort with fewer digits to pass over. One at a
+        // time, to keep the peak memory down.
+        {
+            auto years = make_values(count,
+                DateTime(2000, 1, 1, 0, 0, 0, 0), DateTime(2030, 1, 1, 0, 0, 0, 0)
+            );
+            bench_sort             (bench, "Sort_30Years"            + suffix, years);
+            bench_sort_with_payload(bench, "SortWithPayload_30Years" + suffix, years);
+        }
+        {
+            auto day = make_values(count,
+                DateTime(2020, 1, 1, 0, 0, 0, 0), DateTime(2020, 1, 2, 0, 0, 0, 0)
+            );
+            bench_sort             (bench, "Sort_1Day"            + suffix, day);
+            bench_sort_with_payload(bench, "SortWithPayload_1Day" + suffix, day);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,179 @@
+// std
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "TimeSpan.h"
+#include "TimingWheel.h"
+// Bench
+#include "Bench.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef TimingWheel<std::uint32_t>      Wheel;
+typedef std::pair<time_t, std::uint32_t> QueueEntry;
+typedef std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> Queue;
+
+constexpr time_t k_horizon = TimeSpan::TicksPerHour;
+constexpr time_t k_step    = 10 * TimeSpan::TicksPerMillisecond;
+
+//------------------------------------------------------------------------------
+// Uniform deadlines over the next hour - Like the timeouts of a server.
+std::vector<time_t> make_deadlines(size_t count, time_t start)
+{
+    auto rng          = std::mt19937_64(42);
+    auto distribution = std::uniform_int_distribution<time_t>(start, start + k_horizon);
+
+    auto deadlines = std::vector<time_t>(count);
+    for(auto &deadline : deadlines)
+        deadline = distribution(rng);
+
+    return deadlines;
+}
+
+//------------------------------------------------------------------------------
+Queue make_queue(size_t count)
+{
+    auto storage = std::vector<QueueEntry>();
+    storage.reserve(count);
+
+    return Queue(std::greater<QueueEntry>(), std::move(storage));
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Usage: BenchTimingWheel [count] - 10M timers by default.
+//
+// The std::priority_queue can't cancel an entry, so it does the usual lazy
+// cancel: a flag per timer, skipped when popped at harvest.
+int main(int argc, char *argv[])
+{
+    auto count = (argc > 1) ? size_t(std::stoull(argv[1])) : size_t(10000000);
+    auto bench = Bench("TimingWheel");
+
+    Bench::PrintHeader();
+    bench.Report("Input", "All", "timers", double(count));
+
+    auto start     = DateTime(2024, 1, 1, 0, 0, 0, 0);
+    auto deadlines = make_deadlines(count, start.Ticks());
+
+    //--------------------------------------------------------------------------
+    // Insert - Into a wheel and a queue that already have their memory.
+    {
+        auto wheel = Wheel(start);
+        bench.RunWithSetup("Insert", "CoreTime", count,
+            [&]() { wheel = Wheel(start); wheel.Reserve(count); },
+            [&]() {
+                for(size_t i = 0; i < count; ++i)
+                    wheel.Schedule(DateTime(deadlines[i]), std::uint32_t(i));
+            }
+        );
+
+        auto queue = make_queue(0);
+        bench.RunWithSetup("Insert", "std_priority_queue", count,
+            [&]() { queue = make_queue(count); },
+            [&]() {
+                for(size_t i = 0; i < count; ++i)
+                    queue.emplace(deadlines[i], std::uint32_t(i));
+            }
+        );
+    }
+
+    //--------------------------------------------------------------------------
+    // Cancel - Every other timer, in scheduling order.
+    {
+        auto wheel = Wheel(start);
+        auto ids   = std::vector<Wheel::TimerId>(count);
+        bench.RunWithSetup("Cancel", "CoreTime", count / 2,
+            [&]() {
+                wheel = Wheel(start);
+                wheel.Reserve(count);
+                for(size_t i = 0; i < count; ++i)
+                    ids[i] = wheel.Schedule(DateTime(deadlines[i]), std::uint32_t(i));
+            },
+            [&]() {
+                for(size_t i = 0; i < count; i += 2)
+                    wheel.Cancel(ids[i]);
+            }
+        );
+
+        auto canceled = std::vector<bool>(count);
+        bench.RunWithSetup("Cancel", "std_priority_queue", count / 2,
+            [&]() { canceled.assign(count, false); },
+            [&]() {
+                for(size_t i = 0; i < count; i += 2)
+                    canceled[i] = true;
+            }
+        );
+    }
+
+    //--------------------------------------------------------------------------
+    // Harvest - Advancing by 10ms over the hour, with half the timers
+    // canceled.
+    {
+        auto harvested = size_t(0);
+        auto wheel     = Wheel(start);
+        bench.RunWithSetup("Harvest", "CoreTime", count,
+            [&]() {
+                wheel = Wheel(start);
+                wheel.Reserve(count);
+                for(size_t i = 0; i < count; ++i)
+                {
+                    auto id = wheel.Schedule(DateTime(deadlines[i]), std::uint32_t(i));
+                    if(i % 2 == 0)
+                        wheel.Cancel(id);
+                }
+            },
+            [&]() {
+                for(auto now = start.Ticks(); now <= start.Ticks() + k_horizon + k_step; now += k_step)
+                    harvested += wheel.Advance(DateTime(now), [](std::uint32_t payload) { Bench::DoNotOptimize(payload); });
+            }
+        );
+        Bench::DoNotOptimize(harvested);
+
+        auto queue    = make_queue(0);
+        auto canceled = std::vector<bool>(count);
+        bench.RunWithSetup("Harvest", "std_priority_queue", count,
+            [&]() {
+                queue = make_queue(count);
+                for(size_t i = 0; i < count; ++i)
+                {
+                    queue.emplace(deadlines[i], std::uint32_t(i));
+                    canceled[i] = (i % 2 == 0);
+                }
+            },
+            [&]() {
+                for(auto now = start.Ticks(); now <= start.Ticks() + k_horizon + k_step; now += k_step)
+                {
+                    while(!queue.empty() && queue.top().first <= now)
+                    {
+                        auto payload = queue.top().second;
+                        queue.pop();
+                        if(!canceled[payload])
+                            Bench::DoNotOptimize(payload);
+                    }
+                }
+            }
+        );
+    }
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+// std
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <stdexcept>
+#include <vector>
+// CoreTime
+#include "BusinessCalendar.h"
+#include "CivilCalendar.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef DateTime::DateTimeKind Kind;
+
+constexpr time_t k_first_year = 1999;
+constexpr time_t k_last_year  = 2031;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// Calls func and tells whether it threw a TException.
+template <typename TException, typename TFunc>
+bool throws(TFunc &&func)
+{
+    try { func(); }
+    catch(const TException &) { return true; }
+    catch(...) {}
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// The plain day by day calendar - One flag per day since k_first_year.
+struct Model
+{
+    time_t            firstDay;
+    std::vector<bool> business;
+
+    Model(std::uint8_t weekendDays) :
+        firstDay(CivilCalendar::DaysFromCivil(k_first_year, 1, 1)),
+        business()
+    {
+        auto end = CivilCalendar::DaysFromCivil(k_last_year + 1, 1, 1);
+        for(auto day = firstDay; day < end; ++day)
+        {
+            auto day_of_week = DateTime(day * TimeSpan::TicksPerDay).DayOfWeek();
+            business.push_back(((weekendDays >> day_of_week) & 1) == 0);
+        }
+    }
+
+    time_t Size() const { return time_t(business.size()); }
+
+    //--------------------------------------------------------------------------
+    // Walks a day at a time, counting the business days stepped on - -1
+    // when it walks out of the years.
+    time_t Add(time_t day, time_t count) const
+    {
+        auto step = (count > 0) ? 1 : -1;
+        for(auto left = (count > 0) ? count : -count; left > 0; )
+        {
+            day += step;
+            if(day < 0 || day >= Size())
+                return -1;
+            if(business[size_t(day)])
+                --left;
+        }
+
+        return day;
+    }
+
+    time_t Between(time_t from, time_t to) const
+    {
+        auto count = time_t(0);
+        for(auto day = std::min(from, to); day < std::max(from, to); ++day)
+            count += business[size_t(day)];
+
+        return (to < from) ? -count : count;
+    }
+};
+
+//------------------------------------------------------------------------------
+// The DateTime of the given day of the model, at the given time of day.
+DateTime date_of(const Model &model, time_t day, time_t timeOfDay, Kind kind)
+{
+    return DateTime((model.firstDay + day) * TimeSpan::TicksPerDay + timeOfDay, kind);
+}
+
+//------------------------------------------------------------------------------
+time_t day_of(const Model &model, const DateTime &dateTime)
+{
+    return CivilCalendar::FloorDiv(dateTime.Ticks(), TimeSpan::TicksPerDay) - model.firstDay;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Random holidays and queries against the day by day model, for a few
+// weekend masks.
+void test_against_model(std::uint8_t weekendDays)
+{
+    auto rng      = std::mt19937_64(weekendDays);
+    auto model    = Model(weekendDays);
+    auto calendar = BusinessCalendar(k_first_year, k_last_year, weekendDays);
+    auto any_day  = std::uniform_int_distribution<time_t>(0, model.Size() - 1);
+    auto any_time = std::uniform_int_distribution<time_t>(0, TimeSpan::TicksPerDay - 1);
+
+    //--------------------------------------------------------------------------
+    // A holiday a month on average, some on weekends and some twice.
+    auto holidays = std::vector<DateTime>();
+    for(time_t i = 0; i < model.Size() / 30; ++i)
+    {
+        auto day = any_day(rng);
+        model.business[size_t(day)] = false;
+        holidays.push_back(date_of(model, day, any_time(rng), Kind::UTC));
+    }
+    calendar.AddHolidays(std::span(holidays).first(holidays.size() / 2));
+    for(const auto &holiday : std::span(holidays).subspan(holidays.size() / 2))
+        calendar.AddHoliday(holiday);
+
+    for(time_t day = 0; day < model.Size(); ++day)
+    {
+        check(calendar.IsBusinessDay(date_of(model, day, any_time(rng), Kind::UTC))
+              == model.business[size_t(day)], "IsBusinessDay", day);
+    }
+
+    //--------------------------------------------------------------------------
+    // Counts from a few days to the whole calendar, both ways.
+    for(int i = 0; i < 20000; ++i)
+    {
+        auto day       = any_day(rng);
+        auto timeOfDay = any_time(rng);
+        auto kind      = (i % 2 == 0) ? Kind::UTC : Kind::None;
+        auto dateTime  = date_of(model, day, timeOfDay, kind);
+
+        auto scale = time_t(1) << (rng() % 14);
+        auto count = std::uniform_int_distribution<time_t>(-scale, scale)(rng);
+
+        auto expected = (count == 0) ? day : model.Add(day, count);
+        if(expected < 0)
+        {
+            check(throws<std::out_of_range>([&]() { calendar.AddBusinessDays(dateTime, count); }),
+                  "AddBusinessDays out of the years throws", count);
+            continue;
+        }
+
+        auto result = calendar.AddBusinessDays(dateTime, count);
+        check(day_of(model, result)                  == expected,  "AddBusinessDays day",  count);
+        check(result.Ticks() % TimeSpan::TicksPerDay == timeOfDay, "AddBusinessDays time", count);
+        check(result.Kind()                          == kind,      "AddBusinessDays kind", count);
+        check(calendar.BusinessDaysBetween(dateTime, result) == model.Between(day, expected),
+              "BusinessDaysBetween", count);
+
+        auto other = any_day(rng);
+        check(calendar.BusinessDaysBetween(dateTime, date_of(model, other, 0, kind))
+              == model.Between(day, other), "BusinessDaysBetween random", other - day);
+    }
+
+    //--------------------------------------------------------------------------
+    // Next / Previous - Away from the edges of the years.
+    for(int i = 0; i < 2000; ++i)
+    {
+        auto day      = std::uniform_int_distribution<time_t>(30, model.Size() - 31)(rng);
+        auto dateTime = date_of(model, day, 0, Kind::UTC);
+
+        check(day_of(model, calendar.NextBusinessDay    (dateTime)) == model.Add(day,  1), "NextBusinessDay",     day);
+        check(day_of(model, calendar.PreviousBusinessDay(dateTime)) == model.Add(day, -1), "PreviousBusinessDay", day);
+    }
+
+    //--------------------------------------------------------------------------
+    // The batches give the same values as one by one.
+    auto from = std::vector<time_t>();
+    auto to   = std::vector<time_t>();
+    for(int i = 0; i < 1000; ++i)
+    {
+        auto day = std::uniform_int_distribution<time_t>(30, model.Size() - 31)(rng);
+        from.push_back(date_of(model, day,          any_time(rng), Kind::UTC).Ticks());
+        to  .push_back(date_of(model, any_day(rng), any_time(rng), Kind::UTC).Ticks());
+    }
+
+    auto result = std::vector<time_t>(from.size());
+    calendar.AddBusinessDays(from, 5, result);
+    for(size_t i = 0; i < from.size(); ++i)
+        check(result[i] == calendar.AddBusinessDays(DateTime(from[i]), 5).Ticks(), "batch AddBusinessDays", from[i]);
+
+    calendar.BusinessDaysBetween(from, to, result);
+    for(size_t i = 0; i < from.size(); ++i)
+        check(result[i] == calendar.BusinessDaysBetween(DateTime(from[i]), DateTime(to[i])), "batch BusinessDaysBetween", from[i]);
+
+    //--------------------------------------------------------------------------
+    // In place.
+    auto in_place = from;
+    calendar.AddBusinessDays(in_place, -3, in_place);
+    for(size_t i = 0; i < from.size(); ++i)
+        check(in_place[i] == calendar.AddBusinessDays(DateTime(from[i]), -3).Ticks(), "in place AddBusinessDays", from[i]);
+}
+
+//------------------------------------------------------------------------------
+void test_examples()
+{
+    auto calendar = BusinessCalendar(2024, 2024);
+    calendar.AddHoliday(DateTime(2024, 12, 25, 0, 0, 0, 0));
+
+    auto saturday = DateTime(2024, 6, 15, 10, 30, 0, 0);
+    check(!calendar.IsBusinessDay(saturday),                                             "Saturday",      0);
+    check(calendar.AddBusinessDays(saturday,  0) == saturday,                            "Saturday + 0",  0);
+    check(calendar.AddBusinessDays(saturday,  1) == DateTime(2024, 6, 17, 10, 30, 0, 0), "Saturday + 1",  1);
+    check(calendar.AddBusinessDays(saturday, -1) == DateTime(2024, 6, 14, 10, 30, 0, 0), "Saturday - 1", -1);
+
+    auto christmas_eve = DateTime(2024, 12, 24, 0, 0, 0, 0);
+    check(calendar.NextBusinessDay(christmas_eve) == DateTime(2024, 12, 26, 0, 0, 0, 0), "Christmas", 1);
+
+    //--------------------------------------------------------------------------
+    // 2024 has 262 weekdays - Without Christmas and the last day.
+    check(calendar.BusinessDaysBetween(DateTime(2024, 1, 1, 0, 0, 0, 0), DateTime(2024, 12, 31, 0, 0, 0, 0))
+          == 260, "business days of 2024", 0);
+}
+
+//------------------------------------------------------------------------------
+void test_errors()
+{
+    check(throws<std::invalid_argument>([]() { BusinessCalendar(2025, 2024); }), "reversed years throw", 0);
+
+    auto calendar = BusinessCalendar(2024, 2024);
+    auto outside  = DateTime(2025, 1, 1, 0, 0, 0, 0);
+    check(throws<std::out_of_range>([&]() { calendar.IsBusinessDay(outside); }),      "IsBusinessDay outside",   0);
+    check(throws<std::out_of_range>([&]() { calendar.AddHoliday(outside); }),         "AddHoliday outside",      0);
+    check(throws<std::out_of_range>([&]() { calendar.AddBusinessDays(outside, 1); }), "AddBusinessDays outside", 0);
+    check(throws<std::out_of_range>([&]() { calendar.NextBusinessDay(DateTime(2024, 12, 31, 0, 0, 0, 0)); }),
+          "NextBusinessDay past the years", 0);
+
+    auto ticks  = std::vector<time_t>(2);
+    auto result = std::vector<time_t>(1);
+    check(throws<std::invalid_argument>([&]() { calendar.AddBusinessDays(ticks, 1, result); }),
+          "batch size mismatch", 0);
+    check(throws<std::invalid_argument>([&]() { calendar.BusinessDaysBetween(ticks, result, result); }),
+          "batch size mismatch", 1);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_against_model(BusinessCalendar::SaturdayAndSunday);
+    test_against_model(BusinessCalendar::FridayAndSaturday);
+    test_against_model(0);
+    test_against_model((1 << 0) | (1 << 3));
+    test_examples     ();
+    test_errors       ();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("BusinessCalendar matches the day by day model\n");
+    return 0;
+}
@@ -0,0 +1,215 @@
+// std
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <stdexcept>
+// CoreTime
+#include "CivilCalendar.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+// Every day DateTime can hold.
+constexpr time_t k_first_day = CivilCalendar::FloorDiv(DateTime::MinTicks, TimeSpan::TicksPerDay) + 1;
+constexpr time_t k_last_day  = CivilCalendar::FloorDiv(DateTime::MaxTicks, TimeSpan::TicksPerDay) - 1;
+
+constexpr time_t k_seconds_per_day = TimeSpan::TicksPerDay / TimeSpan::TicksPerSecond;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+void check_fields(const CivilFields &fields, const tm &expected, time_t ticks)
+{
+    check(fields.year      == expected.tm_year + 1900, "year",        ticks);
+    check(fields.month     == expected.tm_mon  + 1,    "month",       ticks);
+    check(fields.day       == expected.tm_mday,        "day",         ticks);
+    check(fields.hour      == expected.tm_hour,        "hour",        ticks);
+    check(fields.minute    == expected.tm_min,         "minute",      ticks);
+    check(fields.second    == expected.tm_sec,         "second",      ticks);
+    check(fields.dayOfWeek == expected.tm_wday,        "day of week", ticks);
+    check(fields.dayOfYear == expected.tm_yday + 1,    "day of year", ticks);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Every day of the range against gmtime_r and timegm, at a different time
+// of the day each.
+void test_every_day()
+{
+    for(auto day = k_first_day; day <= k_last_day; ++day)
+    {
+        auto seconds = day * k_seconds_per_day + CivilCalendar::FloorMod(day * 7919, k_seconds_per_day);
+        auto ticks   = seconds * TimeSpan::TicksPerSecond + CivilCalendar::FloorMod(day, 1000) * TimeSpan::TicksPerMillisecond;
+
+        auto expected = tm{};
+        if(!gmtime_r(&seconds, &expected))
+        {
+            check(false, "gmtime_r failed", seconds);
+            continue;
+        }
+
+        auto fields = CivilCalendar::DecomposeTicks(ticks);
+        check_fields(fields, expected, ticks);
+        check(fields.millisecond == CivilCalendar::FloorMod(day, 1000), "millisecond", ticks);
+
+        check(timegm(&expected) == seconds, "timegm round trip", seconds);
+        check(
+            CivilCalendar::ComposeTicks(
+                fields.year, fields.month, fields.day,
+                fields.hour, fields.minute, fields.second, fields.millisecond
+            ) == ticks,
+            "ComposeTicks",
+            ticks
+        );
+
+        check(CivilCalendar::DaysFromCivil(fields.year, fields.month, fields.day) == day, "DaysFromCivil", day);
+    }
+}
+
+//------------------------------------------------------------------------------
+// DaysInMonth and IsLeapYear of every year of the range against timegm -
+// The day 0 of a month is the last day of the one before.
+void test_every_year()
+{
+    auto first_year = CivilCalendar::DecomposeTicks(k_first_day * TimeSpan::TicksPerDay).year + 1;
+    auto last_year  = CivilCalendar::DecomposeTicks(k_last_day  * TimeSpan::TicksPerDay).year - 1;
+
+    for(auto year = first_year; year <= last_year; ++year)
+    {
+        for(int month = 1; month <= 12; ++month)
+        {
+            auto value    = tm{};
+            value.tm_year = int(year - 1900);
+            value.tm_mon  = month;
+            value.tm_mday = 0;
+
+            auto seconds = timegm(&value);
+            check(DateTime::DaysInMonth(month, year) == value.tm_mday, "DaysInMonth", year * 100 + month);
+            check(DateTime(year, month, 1, 0, 0, 0, 0).Ticks() / TimeSpan::TicksPerSecond
+                  == seconds - (value.tm_mday - 1) * k_seconds_per_day,
+                  "DateTime constructor", year * 100 + month);
+        }
+
+        auto last_day    = tm{};
+        last_day.tm_year = int(year - 1900);
+        last_day.tm_mon  = 11;
+        last_day.tm_mday = 31;
+        timegm(&last_day);
+
+        check(DateTime::IsLeapYear(year) == (last_day.tm_yday == 365), "IsLeapYear", year);
+    }
+
+    //--------------------------------------------------------------------------
+    // Months out of [1, 12] aren't normalized - They throw.
+    for(auto month : { time_t(0), time_t(13), time_t(-1), time_t(1) << 40 })
+    {
+        auto threw = false;
+        try { DateTime::DaysInMonth(month, 2024); }
+        catch(const std::out_of_range &) { threw = true; }
+
+        check(threw, "DaysInMonth of an invalid month throws", month);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Out of range fields are normalized like timegm does.
+void test_normalization()
+{
+    auto rng = std::mt19937_64(2017);
+    auto in  = [&rng](int low, int high) {
+        return int(std::uniform_int_distribution<int>(low, high)(rng));
+    };
+
+    for(int i = 0; i < 1000000; ++i)
+    {
+        auto value    = tm{};
+        value.tm_year = in(-7000, 7000);
+        value.tm_mon  = in(-30, 30);
+        value.tm_mday = in(-60, 90);
+        value.tm_hour = in(-50, 50);
+        value.tm_min  = in(-100, 100);
+        value.tm_sec  = in(-100, 100);
+
+        auto ticks = CivilCalendar::ComposeTicks(
+            value.tm_year + 1900, value.tm_mon + 1, value.tm_mday,
+            value.tm_hour, value.tm_min, value.tm_sec, 0
+        );
+
+        check(ticks == time_t(timegm(&value)) * TimeSpan::TicksPerSecond, "normalized ComposeTicks", i);
+    }
+}
+
+//------------------------------------------------------------------------------
+// DateTime getters of random ticks of the whole range.
+void test_date_time_fields()
+{
+    auto rng          = std::mt19937_64(1970);
+    auto distribution = std::uniform_int_distribution<time_t>(
+        k_first_day * TimeSpan::TicksPerDay,
+        k_last_day  * TimeSpan::TicksPerDay
+    );
+
+    for(int i = 0; i < 1000000; ++i)
+    {
+        auto dateTime = DateTime(distribution(rng));
+        auto seconds  = CivilCalendar::FloorDiv(dateTime.Ticks(), TimeSpan::TicksPerSecond);
+
+        auto expected = tm{};
+        gmtime_r(&seconds, &expected);
+
+        check_fields(dateTime.Fields(), expected, dateTime.Ticks());
+        check(dateTime.Year () == expected.tm_year + 1900, "DateTime::Year",  dateTime.Ticks());
+        check(dateTime.Month() == expected.tm_mon  + 1,    "DateTime::Month", dateTime.Ticks());
+        check(dateTime.Day  () == expected.tm_mday,        "DateTime::Day",   dateTime.Ticks());
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_every_day       ();
+    test_every_year      ();
+    test_normalization   ();
+    test_date_time_fields();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf(
+        "CivilCalendar matches libc from day %" PRId64 " to day %" PRId64 "\n",
+        std::int64_t(k_first_day), std::int64_t(k_last_day)
+    );
+    return 0;
+}
@@ -0,0 +1,206 @@
+// std
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+// CoreTime
+#include "CompressedTickSeries.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr size_t k_count = 100000;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// One value per second from 2020 - Every delta-of-delta is 0.
+std::vector<time_t> make_regular(size_t count)
+{
+    auto first = DateTime(2020, 1, 1, 0, 0, 0, 0).Ticks();
+
+    auto ticks = std::vector<time_t>(count);
+    for(size_t i = 0; i < count; ++i)
+        ticks[i] = first + time_t(i) * TimeSpan::TicksPerSecond;
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+// One value per second with +/-1ms of jitter and a few gaps of up to a
+// day - Every code width up to 32 bits.
+std::vector<time_t> make_jittered(size_t count)
+{
+    auto rng    = std::mt19937_64(42);
+    auto jitter = std::uniform_int_distribution<time_t>(
+        -TimeSpan::TicksPerMillisecond, TimeSpan::TicksPerMillisecond
+    );
+    auto gap    = std::uniform_int_distribution<time_t>(0, TimeSpan::TicksPerDay);
+    auto first  = DateTime(2020, 1, 1, 0, 0, 0, 0).Ticks();
+
+    auto ticks = std::vector<time_t>(count);
+    auto base  = first;
+    for(size_t i = 0; i < count; ++i)
+    {
+        base    += TimeSpan::TicksPerSecond + ((i % 997 == 0) ? gap(rng) : 0);
+        ticks[i] = base + jitter(rng);
+    }
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+// Deltas that only fit the 64 bit escape - Including the extremes of
+// time_t, whose wrapped delta-of-delta has a payload that starts with
+// ones (the window of the decoder is then all ones).
+std::vector<time_t> make_escapes(size_t count)
+{
+    constexpr auto k_min = std::numeric_limits<time_t>::min();
+    constexpr auto k_max = std::numeric_limits<time_t>::max();
+
+    auto rng   = std::mt19937_64(7);
+    auto ticks = std::vector<time_t>{ 0, k_max, k_min, k_max, 0, -1, k_min, k_min, k_max };
+    while(ticks.size() < count)
+        ticks.push_back(time_t(rng()));
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+CompressedTickSeries encode(const std::vector<time_t> &ticks, size_t checkpointInterval)
+{
+    auto series = CompressedTickSeries(checkpointInterval);
+    for(auto value : ticks)
+        series.Append(value);
+
+    return series;
+}
+
+//------------------------------------------------------------------------------
+// Decode of the whole series, At of every value and Decode of ranges that
+// start and end inside the blocks.
+void check_round_trip(const std::vector<time_t> &ticks, size_t checkpointInterval, const char *what)
+{
+    auto series = encode(ticks, checkpointInterval);
+    check(series.Count() == ticks.size(), what, time_t(checkpointInterval));
+
+    auto decoded = std::vector<time_t>(ticks.size());
+    series.Decode(0, decoded);
+    for(size_t i = 0; i < ticks.size(); ++i)
+        check(decoded[i] == ticks[i], what, time_t(i));
+
+    for(size_t i = 0; i < ticks.size(); i += 7)
+        check(series.At(i) == ticks[i], what, time_t(i));
+
+    auto rng = std::mt19937_64(checkpointInterval);
+    for(int i = 0; i < 200; ++i)
+    {
+        auto first = size_t(rng() % ticks.size());
+        auto count = size_t(rng() % (ticks.size() - first + 1));
+
+        auto range = std::vector<time_t>(count);
+        series.Decode(first, range);
+        for(size_t j = 0; j < count; ++j)
+            check(range[j] == ticks[first + j], what, time_t(first + j));
+    }
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void test_regular()
+{
+    auto ticks = make_regular(k_count);
+    for(auto interval : { size_t(1), size_t(63), size_t(1024) })
+        check_round_trip(ticks, interval, "regular round trip");
+
+    //--------------------------------------------------------------------------
+    // Only the first value of each block and a bit per value are stored.
+    auto series = encode(ticks, 1024);
+    check(series.ByteSize() * 8 < k_count * 2, "regular bits per value", time_t(series.ByteSize()));
+}
+
+//------------------------------------------------------------------------------
+void test_jittered()
+{
+    auto ticks = make_jittered(k_count);
+    for(auto interval : { size_t(1), size_t(63), size_t(1024) })
+        check_round_trip(ticks, interval, "jittered round trip");
+}
+
+//------------------------------------------------------------------------------
+void test_escapes()
+{
+    auto ticks = make_escapes(10000);
+    for(auto interval : { size_t(2), size_t(63), size_t(1024) })
+        check_round_trip(ticks, interval, "escape round trip");
+}
+
+//------------------------------------------------------------------------------
+void test_bounds()
+{
+    auto series = encode(make_regular(10), 4);
+
+    auto threw = false;
+    try { series.At(10); } catch(const std::out_of_range &) { threw = true; }
+    check(threw, "At past the end throws", 10);
+
+    threw = false;
+    try {
+        auto ticks = std::vector<time_t>(2);
+        series.Decode(9, ticks);
+    } catch(const std::out_of_range &) { threw = true; }
+    check(threw, "Decode past the end throws", 9);
+
+    auto empty = std::vector<time_t>();
+    series.Decode(10, empty);
+    check(CompressedTickSeries().Count() == 0, "empty series", 0);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_regular ();
+    test_jittered();
+    test_escapes ();
+    test_bounds  ();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("CompressedTickSeries round trips every series\n");
+    return 0;
+}
@@ -0,0 +1,267 @@
+// std
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "DateTimeBatch.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef DateTimeBatch::Kernel  Kernel;
+typedef DateTime::DateTimeUnit Unit;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+const char *kernel_name(Kernel kernel)
+{
+    switch(kernel)
+    {
+        case Kernel::AVX2:  return "AVX2";
+        case Kernel::SSE42: return "SSE42";
+        default:            return "Scalar";
+    }
+}
+
+//------------------------------------------------------------------------------
+// The edges of the range, of the 400 years eras and of the months and
+// days around them, the epoch, and random values both over the whole
+// range and over the recent centuries.
+std::vector<time_t> make_ticks()
+{
+    auto ticks = std::vector<time_t>();
+    auto add_around = [&](time_t center) {
+        for(auto delta : { -TimeSpan::TicksPerDay, -TimeSpan::TicksPerMillisecond, time_t(-1),
+                           time_t(0), time_t(1), TimeSpan::TicksPerMillisecond, TimeSpan::TicksPerDay })
+        {
+            auto value = center + delta;
+            if(value >= DateTime::MinTicks && value <= DateTime::MaxTicks)
+                ticks.push_back(value);
+        }
+    };
+
+    add_around(DateTime::MinTicks);
+    add_around(DateTime::MaxTicks);
+    add_around(0);
+
+    for(auto year : { time_t(-400), time_t(0), time_t(1), time_t(1600), time_t(1900),
+                      time_t(2000), time_t(2100), time_t(2400) })
+    {
+        add_around(DateTime(year, 1, 1, 0, 0, 0, 0).Ticks());
+        add_around(DateTime(year, 3, 1, 0, 0, 0, 0).Ticks());
+        add_around(DateTime(year, 12, 31, 0, 0, 0, 0).Ticks());
+    }
+
+    auto rng    = std::mt19937_64(42);
+    auto whole  = std::uniform_int_distribution<time_t>(DateTime::MinTicks, DateTime::MaxTicks);
+    auto recent = std::uniform_int_distribution<time_t>(
+        DateTime(1800, 1, 1, 0, 0, 0, 0).Ticks(), DateTime(2200, 1, 1, 0, 0, 0, 0).Ticks()
+    );
+    for(int i = 0; i < 50000; ++i)
+    {
+        ticks.push_back(whole (rng));
+        ticks.push_back(recent(rng));
+    }
+
+    return ticks;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Every kernel against the DateTime getters - Over the whole input and
+// over short spans at every offset, so the scalar tails of the SIMD
+// loops run too.
+void test_decompose(std::span<const time_t> ticks, Kernel kernel)
+{
+    auto count   = ticks.size();
+    auto columns = std::vector<std::vector<std::int32_t>>(9, std::vector<std::int32_t>(count));
+
+    auto civil = CivilColumns{
+        columns[0].data(), columns[1].data(), columns[2].data(),
+        columns[3].data(), columns[4].data(), columns[5].data(),
+        columns[6].data(), columns[7].data(), columns[8].data()
+    };
+
+    auto verify = [&](size_t first, size_t last) {
+        for(auto i = first; i < last; ++i)
+        {
+            auto dateTime = DateTime(ticks[i]);
+            check(columns[0][i] == dateTime.Year       (), "year",        ticks[i]);
+            check(columns[1][i] == dateTime.Month      (), "month",       ticks[i]);
+            check(columns[2][i] == dateTime.Day        (), "day",         ticks[i]);
+            check(columns[3][i] == dateTime.Hour       (), "hour",        ticks[i]);
+            check(columns[4][i] == dateTime.Minute     (), "minute",      ticks[i]);
+            check(columns[5][i] == dateTime.Second     (), "second",      ticks[i]);
+            check(columns[6][i] == dateTime.Millisecond(), "millisecond", ticks[i]);
+            check(columns[7][i] == dateTime.DayOfWeek  (), "day of week", ticks[i]);
+            check(columns[8][i] == dateTime.DayOfYear  (), "day of year", ticks[i]);
+        }
+    };
+
+    DateTimeBatch::Decompose(ticks, civil, kernel);
+    verify(0, count);
+
+    for(size_t length = 0; length <= 17; ++length)
+    {
+        for(size_t first = 0; first < 8; ++first)
+        {
+            for(auto &column : columns)
+                std::fill(column.begin(), column.end(), -1);
+
+            auto part = CivilColumns{
+                columns[0].data() + first, columns[1].data() + first, columns[2].data() + first,
+                columns[3].data() + first, columns[4].data() + first, columns[5].data() + first,
+                columns[6].data() + first, columns[7].data() + first, columns[8].data() + first
+            };
+            DateTimeBatch::Decompose(ticks.subspan(first, length), part, kernel);
+            verify(first, first + length);
+
+            //------------------------------------------------------------------
+            // Nothing past the span is written.
+            check(columns[0][first + length] == -1, "write past the span", time_t(length));
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Null columns are skipped.
+    auto years = std::vector<std::int32_t>(count);
+    DateTimeBatch::Decompose(ticks, CivilColumns{ .year = years.data() }, kernel);
+    for(size_t i = 0; i < count; ++i)
+        check(years[i] == DateTime(ticks[i]).Year(), "year only", ticks[i]);
+}
+
+//------------------------------------------------------------------------------
+// Floor / Ceil / Round against the DateTime ones - Values whose result
+// would leave the range are skipped, as the whole call throws then.
+void test_rounding(std::span<const time_t> ticks, Kernel kernel)
+{
+    auto in_range = std::vector<time_t>();
+    for(auto value : ticks)
+    {
+        if(value > DateTime::MinTicks + 400 * 366 * TimeSpan::TicksPerDay
+        && value < DateTime::MaxTicks - 400 * 366 * TimeSpan::TicksPerDay)
+        {
+            in_range.push_back(value);
+        }
+    }
+
+    auto result = std::vector<time_t>(in_range.size());
+    for(auto unit : { Unit::Tick, Unit::Millisecond, Unit::Second, Unit::Minute, Unit::Hour,
+                      Unit::Day,  Unit::Week,        Unit::Month,  Unit::Quarter, Unit::Year })
+    {
+        DateTimeBatch::Floor(in_range, result, unit, kernel);
+        for(size_t i = 0; i < in_range.size(); ++i)
+            check(result[i] == DateTime(in_range[i]).Floor(unit).Ticks(), "Floor unit", in_range[i]);
+
+        DateTimeBatch::Ceil(in_range, result, unit, kernel);
+        for(size_t i = 0; i < in_range.size(); ++i)
+            check(result[i] == DateTime(in_range[i]).Ceil(unit).Ticks(), "Ceil unit", in_range[i]);
+
+        DateTimeBatch::Round(in_range, result, unit, kernel);
+        for(size_t i = 0; i < in_range.size(); ++i)
+            check(result[i] == DateTime(in_range[i]).Round(unit).Ticks(), "Round unit", in_range[i]);
+    }
+
+    for(auto size : { time_t(7), TimeSpan::TicksPerMillisecond, 15 * TimeSpan::TicksPerMinute,
+                      TimeSpan::TicksPerDay + 1, 365 * TimeSpan::TicksPerDay })
+    {
+        auto span = TimeSpan::FromTicks(size);
+
+        DateTimeBatch::Floor(in_range, result, span, kernel);
+        for(size_t i = 0; i < in_range.size(); ++i)
+            check(result[i] == DateTime(in_range[i]).Floor(span).Ticks(), "Floor size", in_range[i]);
+
+        DateTimeBatch::Ceil(in_range, result, span, kernel);
+        for(size_t i = 0; i < in_range.size(); ++i)
+            check(result[i] == DateTime(in_range[i]).Ceil(span).Ticks(), "Ceil size", in_range[i]);
+
+        DateTimeBatch::Round(in_range, result, span, kernel);
+        for(size_t i = 0; i < in_range.size(); ++i)
+            check(result[i] == DateTime(in_range[i]).Round(span).Ticks(), "Round size", in_range[i]);
+    }
+}
+
+//------------------------------------------------------------------------------
+void test_errors()
+{
+    auto ticks  = std::vector<time_t>{ 0, DateTime::MaxTicks };
+    auto result = std::vector<time_t>(2);
+
+    auto threw = false;
+    try { DateTimeBatch::Ceil(ticks, result, Unit::Day); }
+    catch(const std::out_of_range &) { threw = true; }
+    check(threw, "Ceil past MaxTicks throws", DateTime::MaxTicks);
+
+    threw = false;
+    try { DateTimeBatch::Floor(ticks, std::span(result).first(1), Unit::Day); }
+    catch(const std::invalid_argument &) { threw = true; }
+    check(threw, "small result throws", 1);
+
+    threw = false;
+    try { DateTimeBatch::Floor(ticks, result, TimeSpan::FromTicks(0)); }
+    catch(const std::invalid_argument &) { threw = true; }
+    check(threw, "zero size throws", 0);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Kernels the CPU doesn't support are replaced by the best one, so they
+// are only reported as run when the CPU has them.
+int main()
+{
+    auto ticks = make_ticks();
+    auto best  = DateTimeBatch::BestKernel();
+
+    for(auto kernel : { Kernel::Scalar, Kernel::SSE42, Kernel::AVX2 })
+    {
+        test_decompose(ticks, kernel);
+        test_rounding (ticks, kernel);
+        if(int(kernel) <= int(best))
+            std::printf("%s kernel checked\n", kernel_name(kernel));
+    }
+
+    test_errors();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("DateTimeBatch matches the DateTime getters (best kernel %s)\n", kernel_name(best));
+    return 0;
+}
@@ -0,0 +1,176 @@
+// std
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <latch>
+#include <thread>
+#include <vector>
+// CoreTime
+#include "CivilCalendar.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+#include "TimeZone.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr int k_min_threads = 8;
+constexpr int k_iterations  = 20000;
+
+//------------------------------------------------------------------------------
+// Everything a reader can get from a DateTime.
+struct Reading
+{
+    time_t      year;
+    time_t      month;
+    time_t      day;
+    time_t      hour;
+    CivilFields fields;
+    time_t      offsetTicks;
+    bool        isDst;
+
+    bool operator ==(const Reading &rhs) const
+    {
+        auto same_fields = [](const CivilFields &lhs, const CivilFields &rhs) {
+            return lhs.year        == rhs.year
+                && lhs.month       == rhs.month
+                && lhs.day         == rhs.day
+                && lhs.hour        == rhs.hour
+                && lhs.minute      == rhs.minute
+                && lhs.second      == rhs.second
+                && lhs.millisecond == rhs.millisecond
+                && lhs.dayOfWeek   == rhs.dayOfWeek
+                && lhs.dayOfYear   == rhs.dayOfYear;
+        };
+
+        return year        == rhs.year
+            && month       == rhs.month
+            && day         == rhs.day
+            && hour        == rhs.hour
+            && same_fields(fields, rhs.fields)
+            && offsetTicks == rhs.offsetTicks
+            && isDst       == rhs.isDst;
+    }
+};
+
+//------------------------------------------------------------------------------
+Reading read(const DateTime &dateTime)
+{
+    const auto &zone = TimeZone::Local();
+    return Reading{
+        dateTime.Year  (),
+        dateTime.Month (),
+        dateTime.Day   (),
+        dateTime.Hour  (),
+        dateTime.Fields(),
+        zone.GetUtcOffset(dateTime).Ticks(),
+        dateTime.IsDaylightSavingTime()
+    };
+}
+
+//------------------------------------------------------------------------------
+// Local values on both sides of the 2024 European transitions (01:00 UTC)
+// and in other years (so the period cache misses), and a UTC value. They
+// are built from UTC ticks, which doesn't load TimeZone::Local().
+std::vector<DateTime> make_date_times()
+{
+    auto local = [](time_t year, time_t month, time_t day, time_t hour, time_t minute) {
+        auto utc = DateTime(year, month, day, hour, minute, 0, 0);
+        return DateTime(utc.Ticks(), DateTime::DateTimeKind::Local);
+    };
+
+    return {
+        local(2024,  3, 31,  0, 59),
+        local(2024,  3, 31,  1,  0),
+        local(2024, 10, 27,  0, 59),
+        local(2024, 10, 27,  1,  0),
+        local(1990,  7,  1, 12,  0),
+        local(2100,  1,  1, 12,  0),
+        DateTime(2024,  6, 15,  8, 30,  0, 250)
+    };
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// N threads read the same const DateTimes at once and compare what they
+// see with a single threaded read done afterwards. The threads start
+// together, before anything touched TimeZone::Local(), so its loading is
+// raced too. Run it under ThreadSanitizer to also catch the races that
+// don't change a result:
+//   cmake -DCMAKE_CXX_FLAGS=-fsanitize=thread ...
+int main()
+{
+    //--------------------------------------------------------------------------
+    // A zone with DST, unless the caller picked one.
+    setenv("TZ", "Europe/Berlin", 0);
+
+    const auto dateTimes    = make_date_times();
+    const auto thread_count = std::max<int>(k_min_threads, std::thread::hardware_concurrency());
+
+    auto first_readings = std::vector<std::vector<Reading>>(thread_count);
+    auto changed        = std::atomic<int>(0);
+    auto start          = std::latch(thread_count);
+
+    auto threads = std::vector<std::thread>();
+    for(int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            start.arrive_and_wait();
+
+            auto &first = first_readings[t];
+            for(const auto &dateTime : dateTimes)
+                first.push_back(read(dateTime));
+
+            for(int i = 0; i < k_iterations; ++i)
+            {
+                auto index = size_t(i + t) % dateTimes.size();
+                if(!(read(dateTimes[index]) == first[index]))
+                    changed.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    //--------------------------------------------------------------------------
+    // Every thread must have seen what a single thread sees.
+    auto failures = changed.load();
+    for(size_t i = 0; i < dateTimes.size(); ++i)
+    {
+        auto expected = read(dateTimes[i]);
+        for(int t = 0; t < thread_count; ++t)
+        {
+            if(!(first_readings[t][i] == expected))
+            {
+                std::printf("FAIL: thread %d read DateTime %zu differently\n", t, i);
+                ++failures;
+            }
+        }
+    }
+
+    if(failures != 0)
+    {
+        std::printf("%d failures\n", failures);
+        return 1;
+    }
+
+    std::printf(
+        "%d threads read the same DateTimes in %s consistently\n",
+        thread_count, TimeZone::Local().Id().c_str()
+    );
+    return 0;
+}
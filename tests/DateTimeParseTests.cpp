@@ -0,0 +1,245 @@
+// std
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+// CoreTime
+#include "DateTime.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef DateTime::DateTimeKind Kind;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, std::string_view text)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%.*s)\n", what, int(text.size()), text.data());
+}
+
+//------------------------------------------------------------------------------
+time_t ticks_of(time_t year, time_t month, time_t day, time_t hour, time_t minute, time_t second)
+{
+    return DateTime(year, month, day, hour, minute, second, 0).Ticks();
+}
+
+//------------------------------------------------------------------------------
+// Both TryParse and Parse must give the expected ticks and kind.
+void expect_valid(std::string_view text, time_t ticks, Kind kind)
+{
+    auto result = DateTime(0);
+    auto parsed = DateTime::TryParse(text, result);
+    check(parsed,                  "TryParse accepts", text);
+    check(result.Ticks() == ticks, "TryParse ticks",   text);
+    check(result.Kind () == kind,  "TryParse kind",    text);
+
+    try {
+        auto thrown = DateTime::Parse(std::string(text));
+        check(thrown.Ticks() == ticks && thrown.Kind() == kind, "Parse result", text);
+    } catch(const std::exception &) {
+        check(false, "Parse throws on a valid string", text);
+    }
+}
+
+//------------------------------------------------------------------------------
+// TryParse must return false without throwing and leave result alone -
+// Parse must throw std::invalid_argument.
+void expect_invalid(std::string_view text)
+{
+    auto sentinel = DateTime(2000, 1, 1, 0, 0, 0, 0);
+    auto result   = sentinel;
+    try {
+        check(!DateTime::TryParse(text, result), "TryParse rejects",       text);
+        check(result == sentinel,                "TryParse leaves result", text);
+    } catch(const std::exception &) {
+        check(false, "TryParse throws", text);
+    }
+
+    auto threw = false;
+    try { DateTime::Parse(std::string(text)); }
+    catch(const std::invalid_argument &) { threw = true; }
+    catch(const std::exception &) {}
+
+    check(threw, "Parse throws std::invalid_argument", text);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+void test_layouts()
+{
+    auto noon = ticks_of(2024, 2, 29, 13, 45, 30);
+
+    expect_valid("2024-02-29",          ticks_of(2024, 2, 29, 0, 0, 0), Kind::None);
+    expect_valid("2024-02-29T13:45:30", noon,                           Kind::None);
+    expect_valid("2024-02-29t13:45:30", noon,                           Kind::None);
+    expect_valid("2024-02-29 13:45:30", noon,                           Kind::None);
+    expect_valid("1970-01-01T00:00:00", 0,                              Kind::None);
+    expect_valid("1969-12-31T23:59:59", -TimeSpan::TicksPerSecond,      Kind::None);
+    expect_valid("0001-01-01T00:00:00", ticks_of(1, 1, 1, 0, 0, 0),     Kind::None);
+
+    //--------------------------------------------------------------------------
+    // A leap second is taken as :59.
+    expect_valid("2016-12-31T23:59:60Z", ticks_of(2016, 12, 31, 23, 59, 59), Kind::UTC);
+
+    //--------------------------------------------------------------------------
+    // Only the given part of the view is read.
+    auto buffer = std::string_view("2024-02-29T13:45:30Z and more");
+    expect_valid(buffer.substr(0, 20), noon, Kind::UTC);
+    expect_valid(buffer.substr(0, 10), ticks_of(2024, 2, 29, 0, 0, 0), Kind::None);
+}
+
+//------------------------------------------------------------------------------
+void test_offsets()
+{
+    auto noon = ticks_of(2024, 2, 29, 13, 45, 30);
+
+    expect_valid("2024-02-29T13:45:30Z",      noon,                                  Kind::UTC);
+    expect_valid("2024-02-29T13:45:30z",      noon,                                  Kind::UTC);
+    expect_valid("2024-02-29T13:45:30+00:00", noon,                                  Kind::UTC);
+    expect_valid("2024-02-29T13:45:30-00:00", noon,                                  Kind::UTC);
+    expect_valid("2024-02-29T13:45:30+02:00", noon -    2 * TimeSpan::TicksPerHour,   Kind::UTC);
+    expect_valid("2024-02-29T13:45:30-05:30", noon +  330 * TimeSpan::TicksPerMinute, Kind::UTC);
+    expect_valid("2024-02-29T13:45:30+23:59", noon - 1439 * TimeSpan::TicksPerMinute, Kind::UTC);
+
+    //--------------------------------------------------------------------------
+    // LMT offsets have seconds - Sao Paulo was -03:06:28.
+    expect_valid(
+        "1914-01-01T00:00:00-03:06:28",
+        ticks_of(1914, 1, 1, 3, 6, 28),
+        Kind::UTC
+    );
+
+    //--------------------------------------------------------------------------
+    // Offsets that cross a day, a month and a year.
+    expect_valid("2024-01-01T00:30:00+01:00", ticks_of(2023, 12, 31, 23, 30, 0), Kind::UTC);
+    expect_valid("2024-02-29T23:30:00-01:00", ticks_of(2024,  3,  1,  0, 30, 0), Kind::UTC);
+}
+
+//------------------------------------------------------------------------------
+void test_fractions()
+{
+    auto noon = ticks_of(2024, 2, 29, 13, 45, 30);
+
+    expect_valid("2024-02-29T13:45:30.1",       noon + 1000000, Kind::None);
+    expect_valid("2024-02-29T13:45:30.12",      noon + 1200000, Kind::None);
+    expect_valid("2024-02-29T13:45:30.123",     noon + 1230000, Kind::None);
+    expect_valid("2024-02-29T13:45:30.1234",    noon + 1234000, Kind::None);
+    expect_valid("2024-02-29T13:45:30.12345",   noon + 1234500, Kind::None);
+    expect_valid("2024-02-29T13:45:30.123456",  noon + 1234560, Kind::None);
+    expect_valid("2024-02-29T13:45:30.1234567", noon + 1234567, Kind::None);
+    expect_valid("2024-02-29T13:45:30.0000001", noon + 1,       Kind::None);
+    expect_valid("2024-02-29T13:45:30.9999999", noon + 9999999, Kind::None);
+    expect_valid("2024-02-29T13:45:30,5",       noon + 5000000, Kind::None);
+
+    //--------------------------------------------------------------------------
+    // Digits past the tick are truncated.
+    expect_valid("2024-02-29T13:45:30.12345678999", noon + 1234567, Kind::None);
+    expect_valid("2024-02-29T13:45:30.00000009",    noon,           Kind::None);
+
+    //--------------------------------------------------------------------------
+    // With an offset.
+    expect_valid("2024-02-29T13:45:30.1234567Z", noon + 1234567, Kind::UTC);
+    expect_valid(
+        "2024-02-29T13:45:30.5+01:00",
+        noon + 5000000 - TimeSpan::TicksPerHour,
+        Kind::UTC
+    );
+}
+
+//------------------------------------------------------------------------------
+void test_malformed()
+{
+    const char *texts[] = {
+        "",
+        "2024",
+        "2024-02",
+        "2024-2-29",
+        "24-02-29",
+        "2024/02/29",
+        "2024-02-29x13:45:30",
+        "2024-02-29T",
+        "2024-02-29T13",
+        "2024-02-29T13:45",
+        "2024-02-29T13:45:",
+        "2024-02-29T13:45:3",
+        "2024-02-29T1a:45:30",
+        "2024-02-29 ",
+        "2024-02-29T13:45:30 ",
+        "2024-02-29T13:45:30.",
+        "2024-02-29T13:45:30.Z",
+        "2024-02-29T13:45:30.12a",
+        "2024-02-29T13:45:30ZZ",
+        "2024-02-29T13:45:30+",
+        "2024-02-29T13:45:30+01",
+        "2024-02-29T13:45:30+0100",
+        "2024-02-29T13:45:30+1:00",
+        "2024-02-29T13:45:30+24:00",
+        "2024-02-29T13:45:30+01:60",
+        "2024-02-29T13:45:30+01:00:",
+        "2024-02-29T13:45:30+01:00:60",
+        "2024-02-29T13:45:30UTC",
+        "2023-02-29",
+        "2024-02-30",
+        "2024-04-31",
+        "2024-00-10",
+        "2024-13-01",
+        "2024-01-00",
+        "2024-02-29T24:00:00",
+        "2024-02-29T13:60:00",
+        "2024-02-29T13:45:61",
+        "-024-02-29",
+        "+2024-02-29",
+        "9999-12-31T23:59:59.9999999Z",
+        "9999-12-31"
+    };
+
+    for(auto text : texts)
+        expect_invalid(text);
+
+    //--------------------------------------------------------------------------
+    // A valid string cut short by the view.
+    expect_invalid(std::string_view("2024-02-29T13:45:30Z").substr(0, 18));
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_layouts  ();
+    test_offsets  ();
+    test_fractions();
+    test_malformed();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("DateTime parses every valid layout and rejects the malformed ones\n");
+    return 0;
+}
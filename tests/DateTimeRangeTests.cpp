@@ -0,0 +1,288 @@
+// std
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "DateTimeRange.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef DateTime::DateTimeUnit Unit;
+
+static_assert(std::ranges::random_access_range<DateTimeRange>);
+static_assert(std::ranges::sized_range        <DateTimeRange>);
+static_assert(std::ranges::view               <DateTimeRange>);
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// Calls func and tells whether it threw a TException.
+template <typename TException, typename TFunc>
+bool throws(TFunc &&func)
+{
+    try { func(); }
+    catch(const TException &) { return true; }
+    catch(...) {}
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// The values one by one, while they are before last - The i-th value is
+// value(i), which throws once it leaves the DateTime range.
+template <typename TValue>
+std::vector<time_t> model(time_t last, bool forward, TValue value)
+{
+    auto ticks = std::vector<time_t>();
+    for(size_t i = 0; ; ++i)
+    {
+        auto next = time_t(0);
+        try { next = value(i); }
+        catch(const std::out_of_range &) { break; }
+
+        if(forward ? (next >= last) : (next <= last))
+            break;
+
+        ticks.push_back(next);
+    }
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+// Every way of reading the range must give the model values.
+void check_range(const DateTimeRange &range, const std::vector<time_t> &expected, time_t id)
+{
+    check(range.size() == expected.size(), "size", id);
+    if(range.size() != expected.size())
+        return;
+
+    auto count = expected.size();
+    for(size_t i = 0; i < count; ++i)
+    {
+        check(range[i]   .Ticks() == expected[i], "operator []", id);
+        check(range.At(i).Ticks() == expected[i], "At",          id);
+    }
+
+    //--------------------------------------------------------------------------
+    // Iterators, forwards, backwards and jumping.
+    auto index = size_t(0);
+    for(const auto &dateTime : range)
+        check(index < count && dateTime.Ticks() == expected[index++], "iteration", id);
+
+    check(index == count,                                   "iteration count", id);
+    check(std::ranges::distance(range) == ptrdiff_t(count), "distance",        id);
+
+    auto reversed = std::vector<time_t>();
+    for(const auto &dateTime : range | std::views::reverse)
+        reversed.push_back(dateTime.Ticks());
+
+    check(std::equal(reversed.rbegin(), reversed.rend(), expected.begin(), expected.end()), "reverse", id);
+
+    if(count != 0)
+    {
+        auto it = range.begin();
+        check(it[ptrdiff_t(count - 1)].Ticks() == expected.back(), "iterator []", id);
+        check((*(range.end() - 1)).Ticks() == expected.back(),     "end - 1",     id);
+        check(range.front().Ticks() == expected.front(),           "front",       id);
+    }
+
+    check(throws<std::out_of_range>([&]() { range.At(count); }), "At past the end", id);
+
+    //--------------------------------------------------------------------------
+    // FillTicks of every sub range of a few sizes.
+    for(size_t length : { size_t(0), size_t(1), size_t(7), count })
+    {
+        if(length > count)
+            continue;
+
+        auto ticks = std::vector<time_t>(length);
+        for(size_t first = 0; first + length <= count; first += std::max<size_t>(1, count / 5))
+        {
+            range.FillTicks(first, ticks);
+            check(std::equal(ticks.begin(), ticks.end(), expected.begin() + ptrdiff_t(first)), "FillTicks", id);
+        }
+    }
+
+    auto one = std::vector<time_t>(1);
+    check(throws<std::out_of_range>([&]() { range.FillTicks(count, one); }),    "FillTicks past the end",       id);
+    check(throws<std::out_of_range>([&]() { range.FillTicks(count + 1, {}); }), "FillTicks start past the end", id);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Random fixed steps, both ways - Including the ones going away from last,
+// which give empty ranges.
+void test_fixed_steps()
+{
+    auto rng    = std::mt19937_64(42);
+    auto origin = DateTime(2024, 1, 1, 0, 0, 0, 0).Ticks();
+    auto offset = std::uniform_int_distribution<time_t>(-TimeSpan::TicksPerDay * 30, TimeSpan::TicksPerDay * 30);
+    auto scale  = std::uniform_int_distribution<int>(0, 40);
+
+    for(int i = 0; i < 2000; ++i)
+    {
+        auto first = origin + offset(rng);
+        auto last  = origin + offset(rng);
+        auto step  = std::max<time_t>(1, (time_t(1) << scale(rng)) + time_t(rng() % 1000));
+        if(rng() % 2 == 0)
+            step = -step;
+
+        //----------------------------------------------------------------------
+        // At most a few thousands values.
+        if((last - first) / step > 5000)
+            step = (last - first) / 5000 + ((step > 0) ? 1 : -1);
+
+        auto range    = DateTimeRange(DateTime(first), DateTime(last), TimeSpan::FromTicks(step));
+        auto expected = model(last, step > 0, [&](size_t index) { return first + time_t(index) * step; });
+        check_range(range, expected, i);
+    }
+
+    //--------------------------------------------------------------------------
+    // Empty ranges and a single value.
+    auto day      = TimeSpan::FromTicks( TimeSpan::TicksPerDay);
+    auto back_day = TimeSpan::FromTicks(-TimeSpan::TicksPerDay);
+    check(DateTimeRange(DateTime(origin), DateTime(origin),     day     ).size() == 0, "first == last",  0);
+    check(DateTimeRange(DateTime(origin), DateTime(origin + 1), day     ).size() == 1, "single value",   1);
+    check(DateTimeRange(DateTime(origin), DateTime(origin - 1), day     ).size() == 0, "wrong way",     -1);
+    check(DateTimeRange(DateTime(origin), DateTime(origin - 1), back_day).size() == 1, "backwards",     -1);
+
+    check(throws<std::invalid_argument>([&]() { DateTimeRange(DateTime(0), DateTime(1), TimeSpan::FromTicks(0)); }),
+          "zero step throws", 0);
+}
+
+//------------------------------------------------------------------------------
+// Units up to Week are the same as their fixed steps.
+void test_fixed_units()
+{
+    auto first = DateTime(2024, 2, 27, 13, 0, 0, 0);
+    auto last  = DateTime(2024, 3,  2,  1, 0, 0, 0);
+
+    auto units = {
+        std::pair(Unit::Millisecond, TimeSpan::TicksPerMillisecond),
+        std::pair(Unit::Second,      TimeSpan::TicksPerSecond),
+        std::pair(Unit::Minute,      TimeSpan::TicksPerMinute),
+        std::pair(Unit::Hour,        TimeSpan::TicksPerHour),
+        std::pair(Unit::Day,         TimeSpan::TicksPerDay),
+        std::pair(Unit::Week,        TimeSpan::TicksPerDay * 7)
+    };
+
+    for(auto [unit, ticks] : units)
+    {
+        for(auto count : { time_t(1), time_t(3), time_t(-2) })
+        {
+            auto step = ticks * count;
+            auto to   = (count > 0) ? last : DateTime(2024, 2, 1, 0, 0, 0, 0);
+            if((to.Ticks() - first.Ticks()) / step > 100000)
+                continue;
+
+            auto range    = DateTimeRange(first, to, unit, count);
+            auto expected = model(to.Ticks(), count > 0, [&](size_t index) {
+                return first.Ticks() + time_t(index) * step;
+            });
+            check_range(range, expected, time_t(unit) * 100 + count);
+        }
+    }
+
+    check(throws<std::invalid_argument>([&]() { DateTimeRange(first, last, Unit::Day, 0); }),
+          "zero count throws", 0);
+}
+
+//------------------------------------------------------------------------------
+// Calendar steps against AddMonths of the first value - They don't drift
+// on short months.
+void test_calendar_steps()
+{
+    auto rng    = std::mt19937_64(7);
+    auto origin = DateTime(2000, 1, 1, 0, 0, 0, 0).Ticks();
+    auto offset = std::uniform_int_distribution<time_t>(0, TimeSpan::TicksPerDay * 365 * 50);
+
+    for(int i = 0; i < 500; ++i)
+    {
+        auto first  = DateTime(origin + offset(rng));
+        auto last   = DateTime(origin + offset(rng));
+        auto unit   = std::vector{ Unit::Month, Unit::Quarter, Unit::Year }[rng() % 3];
+        auto count  = time_t(rng() % 4 + 1) * ((rng() % 2 == 0) ? 1 : -1);
+        auto months = count * ((unit == Unit::Month) ? 1 : (unit == Unit::Quarter) ? 3 : 12);
+
+        auto range    = DateTimeRange(first, last, unit, count);
+        auto expected = model(last.Ticks(), months > 0, [&](size_t index) {
+            return first.AddMonths(time_t(index) * months).Ticks();
+        });
+        check_range(range, expected, i);
+    }
+
+    //--------------------------------------------------------------------------
+    // From a Jan 31 - Every value is the last day of its month.
+    auto month_ends = DateTimeRange(
+        DateTime(2024, 1, 31, 12, 0, 0, 0), DateTime(2025, 1, 1, 0, 0, 0, 0), Unit::Month
+    );
+    check(month_ends.size() == 12, "month ends count", time_t(month_ends.size()));
+    for(const auto &dateTime : month_ends)
+    {
+        check(dateTime.Day() == DateTime::DaysInMonth(dateTime.Month(), dateTime.Year()),
+              "month end", dateTime.Month());
+        check(dateTime.Hour() == 12, "month end hour", dateTime.Month());
+    }
+
+    //--------------------------------------------------------------------------
+    // Steps that would leave the DateTime range end it.
+    auto near_end = DateTime(DateTime::MaxTicks - TimeSpan::TicksPerDay * 400);
+    auto to_end   = DateTimeRange(near_end, DateTime(DateTime::MaxTicks), Unit::Month);
+    auto expected = model(DateTime::MaxTicks, true, [&](size_t index) {
+        return near_end.AddMonths(time_t(index)).Ticks();
+    });
+    check_range(to_end, expected, 0);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_fixed_steps   ();
+    test_fixed_units   ();
+    test_calendar_steps();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("DateTimeRange matches the value by value model\n");
+    return 0;
+}
@@ -0,0 +1,219 @@
+// std
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <thread>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "TaiDateTime.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+constexpr time_t k_second = TimeSpan::TicksPerSecond;
+
+//------------------------------------------------------------------------------
+// The last second of each day that got a leap second after it, as the IERS
+// Bulletin C announces them.
+constexpr const char *k_leap_seconds[] = {
+    "1972-06-30T23:59:59Z", "1972-12-31T23:59:59Z", "1973-12-31T23:59:59Z",
+    "1974-12-31T23:59:59Z", "1975-12-31T23:59:59Z", "1976-12-31T23:59:59Z",
+    "1977-12-31T23:59:59Z", "1978-12-31T23:59:59Z", "1979-12-31T23:59:59Z",
+    "1981-06-30T23:59:59Z", "1982-06-30T23:59:59Z", "1983-06-30T23:59:59Z",
+    "1985-06-30T23:59:59Z", "1987-12-31T23:59:59Z", "1989-12-31T23:59:59Z",
+    "1990-12-31T23:59:59Z", "1992-06-30T23:59:59Z", "1993-06-30T23:59:59Z",
+    "1994-06-30T23:59:59Z", "1995-12-31T23:59:59Z", "1997-06-30T23:59:59Z",
+    "1998-12-31T23:59:59Z", "2005-12-31T23:59:59Z", "2008-12-31T23:59:59Z",
+    "2012-06-30T23:59:59Z", "2015-06-30T23:59:59Z", "2016-12-31T23:59:59Z",
+};
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// The UTC ticks where each leap second ends - The midnight after it.
+std::vector<time_t> leap_ends()
+{
+    auto ends = std::vector<time_t>();
+    for(auto leap_second : k_leap_seconds)
+        ends.push_back(DateTime::Parse(leap_second).Ticks() + k_second);
+
+    return ends;
+}
+
+//------------------------------------------------------------------------------
+// TAI - UTC in ticks, counting the leap seconds one by one.
+time_t model_offset(const std::vector<time_t> &ends, time_t utcTicks)
+{
+    auto offset = 10 * k_second;
+    for(auto end : ends)
+        offset += (end <= utcTicks) ? k_second : 0;
+
+    return offset;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Random instants of 1900-2100 in random order, so the remembered table
+// entry is right for some and wrong for the others.
+void test_against_model()
+{
+    auto ends         = leap_ends();
+    auto rng          = std::mt19937_64(42);
+    auto distribution = std::uniform_int_distribution<time_t>(
+        DateTime(1900, 1, 1, 0, 0, 0, 0).Ticks(), DateTime(2100, 1, 1, 0, 0, 0, 0).Ticks()
+    );
+
+    for(int i = 0; i < 200000; ++i)
+    {
+        //----------------------------------------------------------------------
+        // Some close to a leap second, some next to the previous one.
+        auto utc = distribution(rng);
+        if(i % 4 == 1)
+            utc = ends[rng() % ends.size()] + time_t(rng() % (4 * k_second)) - 2 * k_second;
+
+        auto offset = model_offset(ends, utc);
+        auto tai    = TaiDateTime::FromUtc(DateTime(utc));
+        check(tai.Ticks() == utc + offset, "FromUtc", utc);
+        check(TaiDateTime::TaiMinusUtcSeconds(DateTime(utc)) == offset / k_second, "TaiMinusUtcSeconds", utc);
+
+        //----------------------------------------------------------------------
+        // UTC instants are never inside a leap second and round trip.
+        check(!tai.IsLeapSecond(),             "IsLeapSecond of an UTC instant", utc);
+        check(tai.ToUtc().Ticks() == utc,      "ToUtc round trip",               utc);
+        check(tai.ToUtc().Kind () == DateTime::DateTimeKind::UTC, "ToUtc kind",  utc);
+
+        auto next = utc + time_t(rng() % (TimeSpan::TicksPerDay * 400));
+        check(TaiDateTime::Elapsed(DateTime(utc), DateTime(next)).Ticks()
+              == next - utc + model_offset(ends, next) - offset, "Elapsed", utc);
+    }
+}
+
+//------------------------------------------------------------------------------
+// 2016-12-31 23:59:60 - The last leap second.
+void test_last_leap_second()
+{
+    auto last_second = DateTime(2016, 12, 31, 23, 59, 59, 0);
+    auto new_year    = DateTime(2017,  1,  1,  0,  0,  0, 0);
+
+    check(TaiDateTime::TaiMinusUtcSeconds(last_second)               == 36, "TAI - UTC before", 36);
+    check(TaiDateTime::TaiMinusUtcSeconds(new_year)                  == 37, "TAI - UTC after",  37);
+    check(TaiDateTime::TaiMinusUtcSeconds(DateTime(2024, 1, 1, 0, 0, 0, 0)) == 37, "TAI - UTC of 2024", 37);
+    check(TaiDateTime::Elapsed(last_second, new_year).Ticks() == 2 * k_second, "Elapsed over the leap second", 2);
+    check(TaiDateTime::Elapsed(DateTime(2016, 1, 1, 0, 0, 0, 0), new_year).Ticks()
+          == 366 * TimeSpan::TicksPerDay + k_second, "Elapsed over 2016", 366);
+
+    //--------------------------------------------------------------------------
+    // The TAI seconds from 23:59:59 to 00:00:00 - 23:59:59, 23:59:60, then
+    // the new year. The leap second reads as a repeat of 23:59:59.
+    auto before = TaiDateTime::FromUtc(last_second);
+    auto leap   = before.Add(TimeSpan::FromTicks(k_second));
+    auto after  = TaiDateTime::FromUtc(new_year);
+
+    check(after.Subtract(leap).Ticks() == k_second, "leap second length", 1);
+    for(auto offset : { time_t(0), time_t(1), k_second / 2, k_second - 1 })
+    {
+        auto in_before = before.Add(TimeSpan::FromTicks(offset));
+        auto in_leap   = leap  .Add(TimeSpan::FromTicks(offset));
+
+        check(!in_before.IsLeapSecond(),                             "23:59:59 is no leap second", offset);
+        check( in_leap  .IsLeapSecond(),                             "23:59:60 is a leap second",  offset);
+        check(in_before.ToUtc().Ticks() == last_second.Ticks() + offset, "23:59:59 ToUtc",         offset);
+        check(in_leap  .ToUtc().Ticks() == last_second.Ticks() + offset, "23:59:60 ToUtc",         offset);
+    }
+
+    check(!after.IsLeapSecond(),                                     "new year is no leap second", 0);
+    check(after.ToUtc() == new_year,                                 "new year ToUtc",             0);
+    check(TaiDateTime(after.Ticks() - 1).ToUtc().Ticks() == new_year.Ticks() - 1, "end of the leap second", -1);
+}
+
+//------------------------------------------------------------------------------
+// Before the first leap second TAI - UTC is 10s, and the edges of the
+// DateTime range convert.
+void test_edges()
+{
+    auto first_end = DateTime(1972, 7, 1, 0, 0, 0, 0);
+    check(TaiDateTime::TaiMinusUtcSeconds(DateTime(0))                         == 10, "TAI - UTC of 1970", 10);
+    check(TaiDateTime::TaiMinusUtcSeconds(first_end.AddTicks(-1))              == 10, "TAI - UTC before 1972-07", 10);
+    check(TaiDateTime::TaiMinusUtcSeconds(first_end)                           == 11, "TAI - UTC of 1972-07", 11);
+    check(TaiDateTime::TaiMinusUtcSeconds(DateTime(DateTime::MinTicks))        == 10, "TAI - UTC of MinTicks", 10);
+    check(TaiDateTime::TaiMinusUtcSeconds(DateTime(DateTime::MaxTicks))        == 37, "TAI - UTC of MaxTicks", 37);
+
+    for(auto utc : { DateTime::MinTicks, DateTime::MaxTicks })
+        check(TaiDateTime::FromUtc(DateTime(utc)).ToUtc().Ticks() == utc, "edge round trip", utc);
+}
+
+//------------------------------------------------------------------------------
+// Each thread keeps its own table entry - Threads far apart in time don't
+// get each other's.
+void test_threads()
+{
+    auto ends    = leap_ends();
+    auto results = std::vector<int>(4);
+    auto threads = std::vector<std::thread>();
+    for(size_t t = 0; t < results.size(); ++t)
+    {
+        threads.emplace_back([&, t]() {
+            auto utc = DateTime(1975 + time_t(t) * 12, 3, 1, 0, 0, 0, 0).Ticks();
+            for(int i = 0; i < 100000; ++i)
+            {
+                auto ticks = utc + time_t(i) * TimeSpan::TicksPerHour;
+                if(TaiDateTime::FromUtc(DateTime(ticks)).Ticks() != ticks + model_offset(ends, ticks))
+                    ++results[t];
+            }
+        });
+    }
+
+    for(auto &thread : threads)
+        thread.join();
+
+    for(size_t t = 0; t < results.size(); ++t)
+        check(results[t] == 0, "thread FromUtc", time_t(t));
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_against_model   ();
+    test_last_leap_second();
+    test_edges           ();
+    test_threads         ();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("TaiDateTime matches the leap second by leap second model\n");
+    return 0;
+}
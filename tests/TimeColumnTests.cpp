@@ -0,0 +1,335 @@
+// std
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+// CoreTime
+#include "DateTime.h"
+#include "TimeColumn.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef DateTime::DateTimeKind Kind;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// A file of the temp directory, unique to this process.
+std::string temp_path(const char *name)
+{
+    auto file_name = "CoreTime_TimeColumnTests_" + std::to_string(getpid()) + "_" + name;
+    return (std::filesystem::temp_directory_path() / file_name).string();
+}
+
+//------------------------------------------------------------------------------
+// Calls func and tells whether it threw a TException.
+template <typename TException, typename TFunc>
+bool throws(TFunc &&func)
+{
+    try { func(); }
+    catch(const TException &) { return true; }
+    catch(...) {}
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// Random ticks of the whole range plus its edges.
+std::vector<time_t> make_ticks(size_t count)
+{
+    auto rng          = std::mt19937_64(42);
+    auto distribution = std::uniform_int_distribution<time_t>(DateTime::MinTicks, DateTime::MaxTicks);
+
+    auto ticks = std::vector<time_t>{ DateTime::MinTicks, DateTime::MaxTicks, 0, -1 };
+    while(ticks.size() < count)
+        ticks.push_back(distribution(rng));
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+void write_bytes(const std::string &path, const void *data, size_t size)
+{
+    auto stream = std::ofstream(path, std::ios::binary | std::ios::trunc);
+    stream.write(static_cast<const char*>(data), std::streamsize(size));
+}
+
+//------------------------------------------------------------------------------
+std::vector<char> read_bytes(const std::string &path)
+{
+    auto stream = std::ifstream(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(stream), {});
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// UTC DateTimes are written as their plain ticks and read back in place.
+void test_date_times()
+{
+    auto path  = temp_path("utc.col");
+    auto ticks = make_ticks(10000);
+
+    auto dateTimes = std::vector<DateTime>();
+    for(auto value : ticks)
+        dateTimes.push_back(DateTime(value, Kind::UTC));
+
+    {
+        auto writer = TimeColumnWriter(path, TimeColumn::ValueType::DateTime);
+        writer.Append(dateTimes.front());
+        writer.Append(std::span(dateTimes).subspan(1));
+        check(writer.Count() == ticks.size(), "writer count", time_t(writer.Count()));
+        writer.Close();
+    }
+
+    check(std::filesystem::file_size(path) == 64 + 8 * ticks.size(), "file size", time_t(ticks.size()));
+
+    auto reader = TimeColumnReader(path);
+    const auto &header = reader.GetHeader();
+    check(std::memcmp(header.magic, "CTCOLUMN", 8) == 0,          "magic",      0);
+    check(header.version    == TimeColumn::Version,               "version",    header.version);
+    check(header.valueType  == TimeColumn::ValueType::DateTime,   "value type", time_t(header.valueType));
+    check(header.kind       == std::uint8_t(Kind::UTC),           "kind",       header.kind);
+    check(header.epochTicks == 0,                                 "epoch",      header.epochTicks);
+    check(header.tickUnit   == 1,                                 "tick unit",  header.tickUnit);
+    check(reader.Count()    == ticks.size(),                      "count",      time_t(reader.Count()));
+
+    auto raw    = reader.RawValues();
+    auto values = reader.DateTimes();
+    for(size_t i = 0; i < ticks.size(); ++i)
+    {
+        check(raw[i]            == ticks[i],  "raw UTC value",  ticks[i]);
+        check(values[i].Ticks() == ticks[i],  "DateTime ticks", ticks[i]);
+        check(values[i].Kind () == Kind::UTC, "DateTime kind",  ticks[i]);
+    }
+
+    check(throws<std::logic_error>([&]() { reader.TimeSpans(); }), "TimeSpans of a DateTime column", 0);
+    std::filesystem::remove(path);
+}
+
+//------------------------------------------------------------------------------
+// Columns of a single other kind keep it in the header - Mixed ones have
+// MixedKinds, and every value keeps its own kind.
+void test_kinds()
+{
+    auto path = temp_path("kinds.col");
+    auto noon = DateTime(2024, 6, 15, 12, 0, 0, 0).Ticks();
+
+    {
+        auto writer = TimeColumnWriter(path, TimeColumn::ValueType::DateTime);
+        writer.Append(DateTime(noon, Kind::None));
+        writer.Append(DateTime(noon + 1, Kind::None));
+    }
+    {
+        auto reader = TimeColumnReader(path);
+        check(reader.GetHeader().kind == std::uint8_t(Kind::None), "None kind", reader.GetHeader().kind);
+        check(reader.DateTimes()[1] == DateTime(noon + 1, Kind::None), "None value", noon + 1);
+    }
+
+    auto mixed = std::vector<DateTime>{
+        DateTime(noon,     Kind::Local),
+        DateTime(noon + 1, Kind::UTC),
+        DateTime(noon + 2, Kind::None),
+        DateTime(DateTime::MinTicks, Kind::Local),
+        DateTime(DateTime::MaxTicks, Kind::None)
+    };
+    {
+        auto writer = TimeColumnWriter(path, TimeColumn::ValueType::DateTime);
+        writer.Append(mixed);
+    }
+
+    auto reader = TimeColumnReader(path);
+    check(reader.GetHeader().kind == TimeColumn::MixedKinds, "mixed kinds", reader.GetHeader().kind);
+    check(reader.Count() == mixed.size(), "mixed count", time_t(reader.Count()));
+
+    auto values = reader.DateTimes();
+    for(size_t i = 0; i < mixed.size(); ++i)
+    {
+        check(values[i].Ticks() == mixed[i].Ticks(), "mixed ticks", time_t(i));
+        check(values[i].Kind () == mixed[i].Kind (), "mixed kind",  time_t(i));
+    }
+
+    std::filesystem::remove(path);
+}
+
+//------------------------------------------------------------------------------
+void test_time_spans()
+{
+    auto path  = temp_path("spans.col");
+    auto ticks = make_ticks(1000);
+    ticks.push_back(TimeSpan::MinValue().Ticks());
+    ticks.push_back(TimeSpan::MaxValue().Ticks());
+
+    {
+        auto writer = TimeColumnWriter(path, TimeColumn::ValueType::TimeSpan);
+        for(auto value : ticks)
+            writer.Append(TimeSpan::FromTicks(value));
+
+        check(throws<std::invalid_argument>([&]() { writer.Append(DateTime(0)); }),
+              "DateTime in a TimeSpan column", 0);
+    }
+
+    auto reader = TimeColumnReader(path);
+    check(reader.GetHeader().valueType == TimeColumn::ValueType::TimeSpan, "TimeSpan type", 0);
+    check(reader.GetHeader().kind      == 0,                               "TimeSpan kind", 0);
+
+    auto values = reader.TimeSpans();
+    check(values.size() == ticks.size(), "TimeSpan count", time_t(values.size()));
+    for(size_t i = 0; i < ticks.size(); ++i)
+        check(values[i].Ticks() == ticks[i], "TimeSpan value", ticks[i]);
+
+    check(throws<std::logic_error>([&]() { reader.DateTimes(); }), "DateTimes of a TimeSpan column", 0);
+
+    //--------------------------------------------------------------------------
+    // And the other way around.
+    auto writer = TimeColumnWriter(path, TimeColumn::ValueType::DateTime);
+    check(throws<std::invalid_argument>([&]() { writer.Append(TimeSpan::FromTicks(1)); }),
+          "TimeSpan in a DateTime column", 0);
+
+    writer.Close();
+    std::filesystem::remove(path);
+}
+
+//------------------------------------------------------------------------------
+// An empty column, and files with other units - Only the raw values can
+// be read.
+void test_headers()
+{
+    auto path = temp_path("headers.col");
+    {
+        auto writer = TimeColumnWriter(path, TimeColumn::ValueType::DateTime);
+    }
+    {
+        auto reader = TimeColumnReader(path);
+        check(reader.Count() == 0 && reader.DateTimes().empty(), "empty column", time_t(reader.Count()));
+    }
+
+    {
+        auto writer = TimeColumnWriter(path, TimeColumn::ValueType::DateTime);
+        writer.Append(DateTime(1000));
+        writer.Append(DateTime(2000));
+    }
+
+    auto bytes  = read_bytes(path);
+    auto header = TimeColumn::Header();
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    header.epochTicks = DateTime(2024, 1, 1, 0, 0, 0, 0).Ticks();
+    header.tickUnit   = TimeSpan::TicksPerSecond;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    write_bytes(path, bytes.data(), bytes.size());
+
+    auto reader = TimeColumnReader(path);
+    check(reader.RawValues()[1] == 2000, "raw value of other units", reader.RawValues()[1]);
+    check(throws<std::logic_error>([&]() { reader.DateTimes(); }), "DateTimes of other units", 0);
+
+    std::filesystem::remove(path);
+}
+
+//------------------------------------------------------------------------------
+// Files that aren't valid columns are rejected before any value is read.
+void test_invalid_files()
+{
+    auto path = temp_path("invalid.col");
+    auto reject = [&](const char *what) {
+        check(throws<std::runtime_error>([&]() { TimeColumnReader reader(path); }), what, 0);
+    };
+
+    std::filesystem::remove(path);
+    reject("missing file");
+
+    write_bytes(path, "CTCOLUMN", 8);
+    reject("file shorter than the header");
+
+    {
+        auto writer = TimeColumnWriter(path, TimeColumn::ValueType::DateTime);
+        writer.Append(DateTime(1));
+        writer.Append(DateTime(2));
+    }
+    auto valid = read_bytes(path);
+
+    auto corrupt = [&](size_t offset, const void *data, size_t size, const char *what) {
+        auto bytes = valid;
+        std::memcpy(bytes.data() + offset, data, size);
+        write_bytes(path, bytes.data(), bytes.size());
+        reject(what);
+    };
+
+    auto bad_version = std::uint16_t(2);
+    auto bad_type    = std::uint8_t(3);
+    auto bad_unit    = std::int64_t(0);
+    auto bad_count   = std::uint64_t(3);
+    auto huge_count  = std::uint64_t(1) << 62;
+
+    corrupt( 0, "CTCOLUMX",   8,                   "bad magic");
+    corrupt( 8, &bad_version, sizeof(bad_version), "bad version");
+    corrupt(10, &bad_type,    sizeof(bad_type),    "bad value type");
+    corrupt(24, &bad_unit,    sizeof(bad_unit),    "zero tick unit");
+    corrupt(32, &bad_count,   sizeof(bad_count),   "count past the end of the file");
+    corrupt(32, &huge_count,  sizeof(huge_count),  "huge count");
+
+    //--------------------------------------------------------------------------
+    // Writers of paths that can't be created throw too.
+    check(
+        throws<std::runtime_error>([&]() {
+            TimeColumnWriter writer(temp_path("missing_dir/column.col"), TimeColumn::ValueType::DateTime);
+        }),
+        "writer of a missing directory", 0
+    );
+
+    std::filesystem::remove(path);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_date_times   ();
+    test_kinds        ();
+    test_time_spans   ();
+    test_headers      ();
+    test_invalid_files();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("TimeColumn round trips every value and rejects invalid files\n");
+    return 0;
+}
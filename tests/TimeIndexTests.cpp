@@ -0,0 +1,224 @@
+// std
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "TimeIndex.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef TimeIndex::Model Model;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// Calls func and tells whether it threw a TException.
+template <typename TException, typename TFunc>
+bool throws(TFunc &&func)
+{
+    try { func(); }
+    catch(const TException &) { return true; }
+    catch(...) {}
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// The sorted ticks of the inputs - From the even spread the interpolation
+// is made for to bursts and long runs of the same value.
+enum class Layout { FixedRate, Uniform, Bursts, Duplicates, FullRange };
+
+std::vector<time_t> make_ticks(size_t count, Layout layout, std::mt19937_64 &rng)
+{
+    auto origin = DateTime(2024, 1, 1, 0, 0, 0, 0).Ticks();
+    auto ticks  = std::vector<time_t>(count);
+
+    switch(layout)
+    {
+        case Layout::FixedRate:
+            for(size_t i = 0; i < count; ++i)
+                ticks[i] = origin + time_t(i) * TimeSpan::TicksPerMillisecond;
+            break;
+
+        case Layout::Uniform:
+            for(auto &value : ticks)
+                value = origin + time_t(rng() % (TimeSpan::TicksPerDay * 30));
+            break;
+
+        case Layout::Bursts:
+            //------------------------------------------------------------------
+            // Bursts of close values hours apart from each other.
+            for(size_t i = 0; i < count; ++i)
+                ticks[i] = origin + time_t(rng() % 8) * TimeSpan::TicksPerHour + time_t(rng() % 1000);
+            break;
+
+        case Layout::Duplicates:
+            for(auto &value : ticks)
+                value = origin + time_t(rng() % 5) * TimeSpan::TicksPerSecond;
+            break;
+
+        case Layout::FullRange:
+            for(auto &value : ticks)
+                value = std::uniform_int_distribution<time_t>(DateTime::MinTicks, DateTime::MaxTicks)(rng);
+            if(count >= 2)
+            {
+                ticks[0] = DateTime::MinTicks;
+                ticks[1] = DateTime::MaxTicks;
+            }
+            break;
+    }
+
+    std::sort(ticks.begin(), ticks.end());
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+// The queries - Every value and its neighbors, random ticks around the
+// values and the extremes of time_t.
+std::vector<time_t> make_queries(const std::vector<time_t> &ticks, std::mt19937_64 &rng)
+{
+    auto queries = std::vector<time_t>{
+        std::numeric_limits<time_t>::min(),
+        std::numeric_limits<time_t>::max(),
+        DateTime::MinTicks,
+        DateTime::MaxTicks,
+        0
+    };
+
+    for(auto value : ticks)
+    {
+        queries.push_back(value);
+        if(value > std::numeric_limits<time_t>::min()) queries.push_back(value - 1);
+        if(value < std::numeric_limits<time_t>::max()) queries.push_back(value + 1);
+    }
+
+    if(!ticks.empty())
+    {
+        auto width        = (ticks.back() - ticks.front()) / 2 + 1;
+        auto distribution = std::uniform_int_distribution<time_t>(ticks.front() - width, ticks.back() + width);
+        for(size_t i = 0; i < 2 * ticks.size() + 100; ++i)
+            queries.push_back(distribution(rng));
+    }
+
+    return queries;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// LowerBound and Range of both models against std::lower_bound - Sizes
+// around the block size and layouts the interpolation likes or not.
+void test_against_lower_bound()
+{
+    auto rng = std::mt19937_64(42);
+    for(size_t count : { 0, 1, 2, 15, 16, 17, 31, 32, 33, 255, 256, 257, 1000, 100003 })
+    {
+        for(auto layout : { Layout::FixedRate, Layout::Uniform, Layout::Bursts, Layout::Duplicates, Layout::FullRange })
+        {
+            auto ticks   = make_ticks(count, layout, rng);
+            auto queries = make_queries(ticks, rng);
+            auto id      = time_t(count) * 10 + time_t(layout);
+
+            auto lower_bound = [&](time_t value) {
+                return size_t(std::lower_bound(ticks.begin(), ticks.end(), value) - ticks.begin());
+            };
+
+            for(auto model : { Model::Eytzinger, Model::PiecewiseLinear })
+            {
+                auto index = TimeIndex(ticks, model);
+                check(index.Count()    == count, "Count",    id);
+                check(index.GetModel() == model, "GetModel", id);
+
+                auto mismatches = time_t(0);
+                for(auto query : queries)
+                    mismatches += (index.LowerBound(query) != lower_bound(query));
+
+                check(mismatches == 0, (model == Model::Eytzinger) ? "Eytzinger LowerBound" : "PiecewiseLinear LowerBound", id);
+
+                //--------------------------------------------------------------
+                // Ranges of DateTimes, reversed ones being empty.
+                auto dates = std::uniform_int_distribution<size_t>(0, queries.size() - 1);
+                for(int i = 0; i < 200; ++i)
+                {
+                    auto from = std::clamp(queries[dates(rng)], DateTime::MinTicks, DateTime::MaxTicks);
+                    auto to   = std::clamp(queries[dates(rng)], DateTime::MinTicks, DateTime::MaxTicks);
+
+                    auto [first, last] = index.Range(DateTime(from), DateTime(to));
+                    check(first == lower_bound(from) && last == std::max(first, lower_bound(to)), "Range", id);
+                    check(index.LowerBound(DateTime(from)) == first, "LowerBound of a DateTime", id);
+                }
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// The index doesn't own the ticks and must be given sorted ones.
+void test_build()
+{
+    auto ticks = std::vector<time_t>(1000);
+    for(size_t i = 0; i < ticks.size(); ++i)
+        ticks[i] = time_t(i) * 10;
+
+    auto eytzinger = TimeIndex(ticks, Model::Eytzinger);
+    auto linear    = TimeIndex(ticks, Model::PiecewiseLinear);
+    check(eytzinger.ByteSize() > 0 && eytzinger.ByteSize() < ticks.size() * sizeof(time_t), "Eytzinger ByteSize", 0);
+    check(linear   .ByteSize() > 0 && linear   .ByteSize() < ticks.size() * sizeof(time_t), "PiecewiseLinear ByteSize", 0);
+    check(TimeIndex(std::vector<time_t>()).LowerBound(0) == 0, "empty LowerBound", 0);
+
+    auto unsorted = std::vector<time_t>{ 1, 3, 2 };
+    check(throws<std::invalid_argument>([&]() { TimeIndex index(unsorted, Model::Eytzinger); }),
+          "Eytzinger of unsorted ticks throws", 0);
+    check(throws<std::invalid_argument>([&]() { TimeIndex index(unsorted, Model::PiecewiseLinear); }),
+          "PiecewiseLinear of unsorted ticks throws", 0);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_against_lower_bound();
+    test_build              ();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("TimeIndex matches std::lower_bound\n");
+    return 0;
+}
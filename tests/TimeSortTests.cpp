@@ -0,0 +1,271 @@
+// std
+#include <algorithm>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "TimeSort.h"
+#include "TimeSpan.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef DateTime::DateTimeKind Kind;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// Calls func and tells whether it threw a TException.
+template <typename TException, typename TFunc>
+bool throws(TFunc &&func)
+{
+    try { func(); }
+    catch(const TException &) { return true; }
+    catch(...) {}
+
+    return false;
+}
+
+//------------------------------------------------------------------------------
+// The ticks of the inputs - From every tick being different to all of
+// them being the same. The ranges are clamped to the DateTime one.
+enum class Spread { Full, Days, Seconds, FewValues, Same };
+
+std::vector<time_t> make_ticks(size_t count, Spread spread, std::mt19937_64 &rng)
+{
+    auto noon  = DateTime(2020, 6, 15, 12, 0, 0, 0).Ticks();
+    auto first = DateTime::MinTicks, last = DateTime::MaxTicks;
+    switch(spread)
+    {
+        case Spread::Full:      break;
+        case Spread::Days:      first = noon - 3 * TimeSpan::TicksPerDay; last = noon + 3 * TimeSpan::TicksPerDay; break;
+        case Spread::Seconds:   first = noon - TimeSpan::TicksPerSecond;  last = noon + TimeSpan::TicksPerSecond;  break;
+        case Spread::FewValues: first = noon - 3;                         last = noon + 3;                         break;
+        case Spread::Same:      first = noon;                             last = noon;                             break;
+    }
+
+    auto distribution = std::uniform_int_distribution<time_t>(first, last);
+    auto ticks        = std::vector<time_t>(count);
+    for(auto &value : ticks)
+        value = distribution(rng);
+
+    //--------------------------------------------------------------------------
+    // The edges of the range, when they are part of it.
+    if(spread == Spread::Full && count >= 2)
+    {
+        ticks[rng() % count] = DateTime::MinTicks;
+        ticks[rng() % count] = DateTime::MaxTicks;
+    }
+
+    return ticks;
+}
+
+//------------------------------------------------------------------------------
+// Every kind mixed up - DateTimes of the same ticks differ by their kind
+// only, so stability can be told apart.
+std::vector<DateTime> make_date_times(const std::vector<time_t> &ticks, std::mt19937_64 &rng)
+{
+    auto values = std::vector<DateTime>();
+    for(auto value : ticks)
+        values.push_back(DateTime(value, Kind(rng() % 3)));
+
+    return values;
+}
+
+//------------------------------------------------------------------------------
+bool same_date_times(const std::vector<DateTime> &lhs, const std::vector<DateTime> &rhs)
+{
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), [](const DateTime &a, const DateTime &b) {
+        return a.Ticks() == b.Ticks() && a.Kind() == b.Kind();
+    });
+}
+
+//------------------------------------------------------------------------------
+// The model - std::stable_sort by ticks.
+template <typename TValue>
+std::vector<TValue> stable_sorted(std::vector<TValue> values)
+{
+    std::stable_sort(values.begin(), values.end(), [](const TValue &lhs, const TValue &rhs) {
+        return lhs.Ticks() < rhs.Ticks();
+    });
+
+    return values;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Sizes around the insertion sort and the parallel thresholds, every spread
+// and thread counts that don't divide the sizes.
+void test_date_times()
+{
+    auto rng = std::mt19937_64(42);
+    for(size_t count : { 0, 1, 2, 63, 64, 65, 1000, 65535, 65536, 200003 })
+    {
+        for(auto spread : { Spread::Full, Spread::Days, Spread::Seconds, Spread::FewValues, Spread::Same })
+        {
+            auto input    = make_date_times(make_ticks(count, spread, rng), rng);
+            auto expected = stable_sorted(input);
+            auto id       = time_t(count) * 10 + time_t(spread);
+
+            auto values = input;
+            TimeSort::SortByTime(std::span(values));
+            check(same_date_times(values, expected), "SortByTime", id);
+
+            for(unsigned threads : { 1u, 2u, 3u, 8u, 0u })
+            {
+                values = input;
+                TimeSort::ParallelSortByTime(std::span(values), threads);
+                check(same_date_times(values, expected), "ParallelSortByTime", id * 10 + threads);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// TimeSpans are signed - Negative ones first, then the positive ones.
+void test_time_spans()
+{
+    auto rng = std::mt19937_64(7);
+    for(size_t count : { 2, 65, 1000, 100000 })
+    {
+        for(auto spread : { Spread::Full, Spread::Seconds, Spread::FewValues })
+        {
+            auto ticks = make_ticks(count, spread, rng);
+            auto input = std::vector<TimeSpan>();
+            for(auto value : ticks)
+                input.push_back(TimeSpan::FromTicks(value - ((spread == Spread::Full) ? 0 : ticks[0])));
+
+            input[rng() % count] = TimeSpan::MinValue();
+            input[rng() % count] = TimeSpan::MaxValue();
+
+            auto expected = stable_sorted(input);
+            auto same     = [&](const std::vector<TimeSpan> &values) {
+                return std::equal(values.begin(), values.end(), expected.begin(), expected.end(),
+                    [](const TimeSpan &a, const TimeSpan &b) { return a.Ticks() == b.Ticks(); });
+            };
+
+            auto values = input;
+            TimeSort::SortByTime(std::span(values));
+            check(same(values), "TimeSpan SortByTime", time_t(count));
+
+            values = input;
+            TimeSort::ParallelSortByTime(std::span(values), 3);
+            check(same(values), "TimeSpan ParallelSortByTime", time_t(count));
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// The payloads follow their keys, in the stable order - Strings check that
+// they are moved rather than lost.
+void test_payloads()
+{
+    auto rng = std::mt19937_64(11);
+    for(size_t count : { 3, 64, 65, 5000, 100000 })
+    {
+        for(auto spread : { Spread::Full, Spread::Days, Spread::FewValues })
+        {
+            auto input = make_date_times(make_ticks(count, spread, rng), rng);
+
+            auto pairs = std::vector<std::pair<DateTime, std::string>>();
+            for(size_t i = 0; i < count; ++i)
+                pairs.emplace_back(input[i], "row " + std::to_string(i));
+
+            std::stable_sort(pairs.begin(), pairs.end(), [](const auto &lhs, const auto &rhs) {
+                return lhs.first.Ticks() < rhs.first.Ticks();
+            });
+
+            for(unsigned threads : { 1u, 4u })
+            {
+                auto keys     = input;
+                auto payloads = std::vector<std::string>();
+                for(size_t i = 0; i < count; ++i)
+                    payloads.push_back("row " + std::to_string(i));
+
+                if(threads == 1)
+                    TimeSort::SortByTime(std::span(keys), std::span(payloads));
+                else
+                    TimeSort::ParallelSortByTime(std::span(keys), std::span(payloads), threads);
+
+                auto matches = true;
+                for(size_t i = 0; i < count; ++i)
+                {
+                    matches = matches
+                        && keys[i].Ticks() == pairs[i].first.Ticks()
+                        && keys[i].Kind () == pairs[i].first.Kind ()
+                        && payloads[i]     == pairs[i].second;
+                }
+                check(matches, "payloads", time_t(count) * 10 + threads);
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // TimeSpan keys too.
+    auto keys     = std::vector<TimeSpan>{ TimeSpan::FromTicks(3), TimeSpan::FromTicks(-1), TimeSpan::FromTicks(3) };
+    auto payloads = std::vector<int>{ 0, 1, 2 };
+    TimeSort::SortByTime(std::span(keys), std::span(payloads));
+    check(payloads == std::vector<int>{ 1, 0, 2 }, "TimeSpan payloads", 0);
+}
+
+//------------------------------------------------------------------------------
+void test_errors()
+{
+    auto keys     = std::vector<DateTime>(3, DateTime(0));
+    auto payloads = std::vector<int>(2);
+    check(throws<std::invalid_argument>([&]() { TimeSort::SortByTime(std::span(keys), std::span(payloads)); }),
+          "SortByTime size mismatch", 0);
+    check(throws<std::invalid_argument>([&]() { TimeSort::ParallelSortByTime(std::span(keys), std::span(payloads)); }),
+          "ParallelSortByTime size mismatch", 0);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_date_times();
+    test_time_spans();
+    test_payloads  ();
+    test_errors    ();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("TimeSort matches std::stable_sort\n");
+    return 0;
+}
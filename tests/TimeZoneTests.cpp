@@ -0,0 +1,395 @@
+// std
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+// CoreTime
+#include "BusinessCalendar.h"
+#include "DateTime.h"
+#include "TimeSpan.h"
+#include "TimeZone.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef DateTime::DateTimeKind Kind;
+
+constexpr time_t k_second = TimeSpan::TicksPerSecond;
+constexpr time_t k_hour   = TimeSpan::TicksPerHour;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// The zoneinfo directory of the test zones, unique to this process.
+std::filesystem::path zoneinfo_path()
+{
+    auto directory = "CoreTime_TimeZoneTests_" + std::to_string(getpid());
+    return std::filesystem::temp_directory_path() / directory;
+}
+
+//------------------------------------------------------------------------------
+// Writes a TZif version 2 file (RFC 8536) with the given transitions (UTC
+// seconds and type index), types (UTC offset in seconds and DST flag) and
+// POSIX TZ footer. The version 1 block only has a single type, as readers
+// of version 2 files skip it.
+struct TzifType
+{
+    std::int32_t utcOffset;
+    bool         isDst;
+};
+
+struct TzifTransition
+{
+    std::int64_t seconds;
+    std::uint8_t type;
+};
+
+void write_tzif(
+    const std::string                 &id,
+    const std::vector<TzifTransition> &transitions,
+    const std::vector<TzifType>       &types,
+    const std::string                 &footer)
+{
+    auto bytes = std::vector<char>();
+    auto put   = [&](std::int64_t value, int size) {
+        for(int i = size; i-- > 0;)
+            bytes.push_back(char((value >> (i * 8)) & 0xFF));
+    };
+    auto put_header = [&](size_t timeCount, size_t typeCount) {
+        bytes.insert(bytes.end(), { 'T', 'Z', 'i', 'f', '2' });
+        bytes.insert(bytes.end(), 15, '\0');
+        for(auto count : { size_t(0), size_t(0), size_t(0), timeCount, typeCount, size_t(1) })
+            put(std::int64_t(count), 4);
+    };
+
+    put_header(0, 1);
+    put(types[0].utcOffset, 4);
+    put(types[0].isDst,     1);
+    put(0, 1);
+    put(0, 1);
+
+    put_header(transitions.size(), types.size());
+    for(const auto &transition : transitions)
+        put(transition.seconds, 8);
+    for(const auto &transition : transitions)
+        put(transition.type, 1);
+    for(const auto &type : types)
+    {
+        put(type.utcOffset, 4);
+        put(type.isDst,     1);
+        put(0,              1);
+    }
+    put(0, 1);
+
+    bytes.push_back('\n');
+    bytes.insert(bytes.end(), footer.begin(), footer.end());
+    bytes.push_back('\n');
+
+    auto path = zoneinfo_path() / id;
+    std::filesystem::create_directories(path.parent_path());
+
+    auto stream = std::ofstream(path, std::ios::binary | std::ios::trunc);
+    stream.write(bytes.data(), std::streamsize(bytes.size()));
+}
+
+//------------------------------------------------------------------------------
+time_t utc_ticks(time_t year, time_t month, time_t day, time_t hour, time_t minute, time_t second = 0)
+{
+    return DateTime(year, month, day, hour, minute, second, 0).Ticks();
+}
+
+//------------------------------------------------------------------------------
+// The day of the given Sunday of a month - Counting back from the end of
+// the month for the last one.
+time_t first_sunday(time_t year, time_t month)
+{
+    auto day = time_t(1);
+    while(DateTime(year, month, day, 0, 0, 0, 0).DayOfWeek() != 0)
+        ++day;
+
+    return day;
+}
+
+time_t last_sunday(time_t year, time_t month)
+{
+    auto day = DateTime::DaysInMonth(month, year);
+    while(DateTime(year, month, day, 0, 0, 0, 0).DayOfWeek() != 0)
+        --day;
+
+    return day;
+}
+
+//------------------------------------------------------------------------------
+// The test zones:
+//   Test/Berlin    - CET / CEST transitions of 2020-2023, then the footer.
+//   Test/Sao_Paulo - The LMT of -03:06:28 until 1914, then -03.
+//   Test/Sydney    - No transition at all, only a southern footer.
+void write_zones()
+{
+    auto berlin = std::vector<TzifTransition>();
+    for(time_t year = 2020; year <= 2023; ++year)
+    {
+        berlin.push_back({ utc_ticks(year,  3, last_sunday(year,  3), 1, 0) / k_second, 1 });
+        berlin.push_back({ utc_ticks(year, 10, last_sunday(year, 10), 1, 0) / k_second, 0 });
+    }
+    write_tzif("Test/Berlin", berlin, { { 3600, false }, { 7200, true } }, "CET-1CEST,M3.5.0,M10.5.0/3");
+
+    write_tzif(
+        "Test/Sao_Paulo",
+        { { utc_ticks(1914, 1, 1, 3, 6, 28) / k_second, 1 } },
+        { { -11188, false }, { -10800, false } },
+        "<-03>3"
+    );
+
+    write_tzif("Test/Sydney", {}, { { 36000, false } }, "AEST-10AEDT,M10.1.0,M4.1.0/3");
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// 2021-03-28 - Berlin skips from 02:00 to 03:00 (01:00 UTC).
+void test_gap(const TimeZone &berlin)
+{
+    auto change = utc_ticks(2021, 3, 28, 1, 0);
+    auto wall   = [](time_t hour, time_t minute) { return utc_ticks(2021, 3, 28, hour, minute); };
+
+    auto before = berlin.GetPeriod(change - 1);
+    auto after  = berlin.GetPeriod(change);
+    check(before.utcOffset == 3600 && !before.isDst && before.until == change, "period before the gap", 0);
+    check(after .utcOffset == 7200 &&  after .isDst && after .from  == change, "period after the gap",  0);
+    check(after.until == utc_ticks(2021, 10, 31, 1, 0), "period after the gap until", 0);
+
+    //--------------------------------------------------------------------------
+    // Skipped wall clocks are moved forward by the length of the gap.
+    check(berlin.ToUtcTicks(wall(1, 59)) == utc_ticks(2021, 3, 28, 0, 59), "01:59 before the gap", 159);
+    check(berlin.ToUtcTicks(wall(2,  0)) == change,                        "02:00 in the gap",     200);
+    check(berlin.ToUtcTicks(wall(2, 30)) == utc_ticks(2021, 3, 28, 1, 30), "02:30 in the gap",     230);
+    check(berlin.ToUtcTicks(wall(3,  0)) == change,                        "03:00 after the gap",  300);
+
+    auto skipped = DateTime(2021, 3, 28, 2, 30, 0, 0, Kind::Local);
+    check(skipped.Hour() == 3 && skipped.Minute() == 30, "Local 02:30 reads 03:30", skipped.Hour());
+    check(skipped.IsDaylightSavingTime(),                "Local 02:30 is DST",      0);
+
+    auto converted = berlin.ConvertFromUtc(DateTime(utc_ticks(2021, 3, 28, 1, 30)));
+    check(converted.Ticks() == wall(3, 30) && converted.Kind() == Kind::None, "ConvertFromUtc after the gap", 0);
+}
+
+//------------------------------------------------------------------------------
+// 2021-10-31 - Berlin goes back from 03:00 to 02:00 (01:00 UTC), so the
+// wall clocks of 02:00-03:00 happen twice.
+void test_overlap(const TimeZone &berlin)
+{
+    auto change = utc_ticks(2021, 10, 31, 1, 0);
+    auto wall   = [](time_t hour, time_t minute) { return utc_ticks(2021, 10, 31, hour, minute); };
+
+    check(berlin.GetPeriod(change - 1).utcOffset == 7200, "period before the overlap", 0);
+    check(berlin.GetPeriod(change    ).utcOffset == 3600, "period after the overlap",  0);
+
+    //--------------------------------------------------------------------------
+    // Ambiguous wall clocks resolve to the earliest instant.
+    check(berlin.ToUtcTicks(wall(1, 59)) == wall(1, 59) - 2 * k_hour, "01:59 before the overlap", 159);
+    check(berlin.ToUtcTicks(wall(2, 30)) == wall(2, 30) - 2 * k_hour, "02:30 in the overlap",     230);
+    check(berlin.ToUtcTicks(wall(3,  0)) == wall(3,  0) - 1 * k_hour, "03:00 after the overlap",  300);
+
+    auto first  = DateTime(utc_ticks(2021, 10, 31, 0, 30), Kind::Local);
+    auto second = DateTime(utc_ticks(2021, 10, 31, 1, 30), Kind::Local);
+    check(first .Hour() == 2 && first .Minute() == 30, "first 02:30",  0);
+    check(second.Hour() == 2 && second.Minute() == 30, "second 02:30", 0);
+    check(first.IsDaylightSavingTime() && !second.IsDaylightSavingTime(), "DST of the two 02:30", 0);
+
+    check(DateTime(2021, 10, 31, 2, 30, 0, 0, Kind::Local) == first, "Local 02:30 is the first one", 0);
+    check(berlin.GetUtcOffset(DateTime(wall(2, 30), Kind::None)).Ticks() == 2 * k_hour,
+          "GetUtcOffset of an ambiguous wall clock", 0);
+}
+
+//------------------------------------------------------------------------------
+// Sao Paulo was 3:06:28 behind UTC until 1914 - Offsets aren't whole
+// minutes, and the switch to -03 skipped 6:28 of wall clock.
+void test_sub_minute_offset(const TimeZone &saoPaulo)
+{
+    auto change = utc_ticks(1914, 1, 1, 3, 6, 28);
+    auto lmt    = -(3 * k_hour + 6 * TimeSpan::TicksPerMinute + 28 * k_second);
+
+    check(saoPaulo.GetPeriod(change - 1).utcOffset == -11188, "LMT offset", -11188);
+    check(saoPaulo.GetPeriod(change    ).utcOffset == -10800, "-03 offset", -10800);
+    check(saoPaulo.GetUtcOffset(DateTime(1900, 1, 1, 0, 0, 0, 0)).Ticks() == lmt, "GetUtcOffset of LMT", 0);
+
+    auto utc  = DateTime(1900, 1, 1, 0, 0, 0, 0);
+    auto wall = saoPaulo.ConvertFromUtc(utc);
+    check(wall.Ticks() == utc_ticks(1899, 12, 31, 20, 53, 32), "ConvertFromUtc of LMT", 0);
+    check(wall.Second() == 32,                                 "LMT seconds",           wall.Second());
+    check(saoPaulo.ConvertToUtc(wall) == utc,                  "ConvertToUtc of LMT",   0);
+
+    //--------------------------------------------------------------------------
+    // 00:00:00 LMT was followed by 00:06:28 -03.
+    check(saoPaulo.ToUtcTicks(utc_ticks(1914, 1, 1, 0, 3, 0)) == utc_ticks(1914, 1, 1, 3, 9, 28),
+          "wall clock skipped by the LMT change", 0);
+
+    //--------------------------------------------------------------------------
+    // The footer has no DST - -03 from the change on.
+    auto later = saoPaulo.GetPeriod(utc_ticks(2050, 6, 1, 0, 0));
+    check(later.utcOffset == -10800 && later.from == change && later.until > DateTime::MaxTicks,
+          "footer without DST", 0);
+}
+
+//------------------------------------------------------------------------------
+// Past 2023 the footer rule - DST from the last Sunday of March to the
+// last Sunday of October, at 01:00 UTC.
+void test_footer(const TimeZone &berlin)
+{
+    auto last_change = utc_ticks(2023, 10, 29, 1, 0);
+    auto first_rule  = berlin.GetPeriod(last_change);
+    check(first_rule.from  == last_change,                   "first rule period from",  0);
+    check(first_rule.until == utc_ticks(2024, 3, 31, 1, 0),  "first rule period until", 0);
+    check(first_rule.utcOffset == 3600 && !first_rule.isDst, "first rule period type",  0);
+
+    //--------------------------------------------------------------------------
+    // From the end of the century back, so the period cache misses.
+    for(time_t year = 2200; year >= 2024; --year)
+    {
+        auto start = utc_ticks(year,  3, last_sunday(year,  3), 1, 0);
+        auto end   = utc_ticks(year, 10, last_sunday(year, 10), 1, 0);
+
+        auto winter = berlin.GetPeriod(start - 1);
+        auto summer = berlin.GetPeriod(start);
+        auto autumn = berlin.GetPeriod(end);
+        check(winter.utcOffset == 3600 && !winter.isDst && winter.until == start, "footer winter", year);
+        check(summer.utcOffset == 7200 &&  summer.isDst && summer.from  == start
+           && summer.until == end,                                                "footer summer", year);
+        check(autumn.utcOffset == 3600 && !autumn.isDst && autumn.from  == end,   "footer autumn", year);
+    }
+
+    auto gap = utc_ticks(2030, 3, 31, 2, 30);
+    check(berlin.ToUtcTicks(gap) == utc_ticks(2030, 3, 31, 1, 30), "footer gap", 2030);
+}
+
+//------------------------------------------------------------------------------
+// A footer only zone of the southern hemisphere - DST spans the new year,
+// from the first Sunday of October 02:00 to the first Sunday of April
+// 03:00 (local times).
+void test_southern_footer(const TimeZone &sydney)
+{
+    for(time_t year = 2000; year <= 2100; ++year)
+    {
+        auto end   = utc_ticks(year,  4, first_sunday(year,  4), 3, 0) - 11 * k_hour;
+        auto start = utc_ticks(year, 10, first_sunday(year, 10), 2, 0) - 10 * k_hour;
+
+        check(sydney.GetPeriod(end   - 1).utcOffset == 39600, "southern DST before April",     year);
+        check(sydney.GetPeriod(end      ).utcOffset == 36000, "southern standard from April",  year);
+        check(sydney.GetPeriod(start - 1).utcOffset == 36000, "southern standard before Oct",  year);
+        check(sydney.GetPeriod(start    ).isDst,              "southern DST from October",     year);
+        check(sydney.GetPeriod(utc_ticks(year, 1, 1, 0, 0)).isDst, "southern DST at new year", year);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Local is Test/Berlin - None DateTimes are wall clocks of no zone, taken
+// as UTC by the conversions of DateTime.
+void test_kinds()
+{
+    check(TimeZone::Local().Id() == "Test/Berlin", "Local zone from TZ", 0);
+
+    auto noon  = utc_ticks(2021, 7, 1, 12, 0);
+    auto local = DateTime(2021, 7, 1, 12, 0, 0, 0, Kind::Local);
+    check(local.Ticks() == noon - 2 * k_hour && local.Hour() == 12, "Local constructor", 0);
+    check(local.ToLocalTimePoint().time_since_epoch().count() == noon, "ToLocalTimePoint of Local", 0);
+
+    auto none = DateTime(noon, Kind::None);
+    check(none.Hour() == 12 && !none.IsDaylightSavingTime(), "None fields as they are", 0);
+
+    auto to_utc = none;
+    to_utc.ToUniversalTime();
+    check(to_utc.Ticks() == noon && to_utc.Kind() == Kind::UTC, "None ToUniversalTime relabels", 0);
+
+    auto to_local = none;
+    to_local.ToLocalTime();
+    check(to_local.Ticks() == noon && to_local.Kind() == Kind::Local, "None ToLocalTime relabels", 0);
+
+    auto from_wall = TimeZone::Local().ConvertToUtc(none);
+    check(from_wall.Ticks() == noon - 2 * k_hour && from_wall.Kind() == Kind::UTC, "None ConvertToUtc", 0);
+
+    auto back = local;
+    back.ToUniversalTime();
+    check(back.Ticks() == local.Ticks() && back.Kind() == Kind::UTC, "Local ToUniversalTime", 0);
+
+    //--------------------------------------------------------------------------
+    // BusinessCalendar keeps the local wall clock across the DST change -
+    // And moves it forward out of the gap.
+    auto calendar = BusinessCalendar(2021, 2021);
+    auto friday   = DateTime(2021, 3, 26, 12, 0, 0, 0, Kind::Local);
+    auto monday   = calendar.AddBusinessDays(friday, 1);
+    check(monday.Ticks() == utc_ticks(2021, 3, 29, 10, 0) && monday.Kind() == Kind::Local,
+          "Local AddBusinessDays across DST", 0);
+
+    auto every_day = BusinessCalendar(2021, 2021, 0);
+    auto saturday  = DateTime(2021, 3, 27, 2, 30, 0, 0, Kind::Local);
+    auto sunday    = every_day.AddBusinessDays(saturday, 1);
+    check(sunday.Day() == 28 && sunday.Hour() == 3 && sunday.Minute() == 30, "Local AddBusinessDays into the gap", 0);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    //--------------------------------------------------------------------------
+    // Both are read once, before anything asks for a zone.
+    write_zones();
+    setenv("TZDIR", zoneinfo_path().c_str(), 1);
+    setenv("TZ",    "Test/Berlin",           1);
+
+    auto berlin    = TimeZone::FindSystemTimeZoneById("Test/Berlin");
+    auto sao_paulo = TimeZone::FindSystemTimeZoneById("Test/Sao_Paulo");
+    auto sydney    = TimeZone::FindSystemTimeZoneById("Test/Sydney");
+    check(berlin && sao_paulo && sydney, "test zones load", 0);
+
+    if(berlin && sao_paulo && sydney)
+    {
+        test_gap              (*berlin);
+        test_overlap          (*berlin);
+        test_sub_minute_offset(*sao_paulo);
+        test_footer           (*berlin);
+        test_southern_footer  (*sydney);
+        test_kinds            ();
+    }
+
+    std::filesystem::remove_all(zoneinfo_path());
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("TimeZone handles gaps, overlaps, LMT offsets and footers\n");
+    return 0;
+}
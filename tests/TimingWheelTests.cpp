@@ -0,0 +1,248 @@
+// std
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <ctime>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+// CoreTime
+#include "DateTime.h"
+#include "TimeSpan.h"
+#include "TimingWheel.h"
+// Usings
+USING_NS_CORETIME;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+namespace {
+
+//------------------------------------------------------------------------------
+typedef TimingWheel<std::uint64_t> Wheel;
+
+constexpr time_t k_resolution = TimeSpan::TicksPerMillisecond;
+
+int g_failures = 0;
+
+//------------------------------------------------------------------------------
+// Reports the first few mismatches - The others are only counted.
+void check(bool condition, const char *what, time_t value)
+{
+    if(condition)
+        return;
+
+    if(++g_failures <= 20)
+        std::printf("FAIL: %s (%" PRId64 ")\n", what, std::int64_t(value));
+}
+
+//------------------------------------------------------------------------------
+// The wheel rounds deadlines up to its resolution from its start.
+time_t to_units(time_t origin, time_t ticks)
+{
+    auto elapsed = ticks - origin;
+    return (elapsed <= 0) ? 0 : (elapsed + k_resolution - 1) / k_resolution;
+}
+
+//------------------------------------------------------------------------------
+// A delay from a few ticks to weeks (or to 10 years with the top scale) -
+// Every level of the wheel, and some deadlines in the past.
+time_t random_delay(std::mt19937_64 &rng, int maxScale)
+{
+    auto scale = std::uniform_int_distribution<int>(0, maxScale)(rng);
+    auto range = (scale == 9)
+        ? TimeSpan::TicksPerDay * 3650
+        : time_t(1) << (scale * 5 + 4);
+
+    return std::uniform_int_distribution<time_t>(-range / 16, range)(rng);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Random schedules, cancels and advances against a multimap of the rounded
+// deadlines. Timers of the same deadline can expire in any order, but the
+// deadlines must come in order and each Advance must expire exactly the
+// timers of the model. Deadlines already past when scheduled are due at
+// the current time of the wheel.
+void test_against_model()
+{
+    auto rng    = std::mt19937_64(2024);
+    auto origin = DateTime(2024, 1, 1, 0, 0, 0, 0).Ticks();
+    auto wheel  = Wheel(DateTime(origin), TimeSpan::FromTicks(k_resolution));
+    auto now    = origin;
+
+    auto model     = std::multimap<time_t, std::uint64_t>();          // units -> payload
+    auto live      = std::map<std::uint64_t, std::pair<Wheel::TimerId, time_t>>();
+    auto dead      = std::vector<Wheel::TimerId>();
+    auto next_id   = std::uint64_t(0);
+    auto operation = std::uniform_int_distribution<int>(0, 99);
+
+    for(int step = 0; step < 400000; ++step)
+    {
+        auto op = operation(rng);
+        if(op < 55)
+        {
+            //------------------------------------------------------------------
+            // Schedule.
+            auto deadline = now + random_delay(rng, 9);
+            auto units    = std::max(to_units(origin, deadline), to_units(origin, now));
+            auto id       = next_id++;
+
+            auto timerId = wheel.Schedule(DateTime(deadline), id);
+            model.emplace(units, id);
+            live[id] = { timerId, units };
+        }
+        else if(op < 75)
+        {
+            //------------------------------------------------------------------
+            // Cancel a live timer - Or a dead one, that must be rejected.
+            if(!dead.empty() && op < 60)
+            {
+                auto timerId = dead[rng() % dead.size()];
+                check(!wheel.Cancel(timerId), "cancel of a dead timer", step);
+                continue;
+            }
+            if(live.empty())
+                continue;
+
+            auto it = live.lower_bound(rng() % next_id);
+            if(it == live.end())
+                it = live.begin();
+
+            auto [timerId, units] = it->second;
+            check(wheel.Cancel(timerId), "cancel of a live timer", step);
+
+            auto range = model.equal_range(units);
+            for(auto m = range.first; m != range.second; ++m)
+            {
+                if(m->second == it->first)
+                {
+                    model.erase(m);
+                    break;
+                }
+            }
+            dead.push_back(timerId);
+            live.erase(it);
+        }
+        else
+        {
+            //------------------------------------------------------------------
+            // Advance - Mostly small steps, sometimes far (but staying
+            // within a few thousand years).
+            auto jump = (op < 99) ? random_delay(rng, 8) : TimeSpan::TicksPerDay * 400;
+            now       = std::max(now, now + jump);
+
+            auto target   = to_units(origin, now);
+            auto expired  = std::vector<std::uint64_t>();
+            auto previous = time_t(-1);
+
+            auto count = wheel.Advance(DateTime(now), [&](std::uint64_t id) {
+                auto it = live.find(id);
+                if(it == live.end())
+                {
+                    check(false, "expired an unknown timer", time_t(id));
+                    return;
+                }
+
+                auto units = it->second.second;
+                check(units >= previous, "expired out of deadline order", time_t(id));
+                check(units <= target,   "expired early",                 time_t(id));
+
+                previous = units;
+                expired.push_back(id);
+                dead.push_back(it->second.first);
+                live.erase(it);
+            });
+
+            auto expected = std::vector<std::uint64_t>();
+            while(!model.empty() && model.begin()->first <= target)
+            {
+                expected.push_back(model.begin()->second);
+                model.erase(model.begin());
+            }
+
+            std::sort(expired .begin(), expired .end());
+            std::sort(expected.begin(), expected.end());
+            check(count == expired.size(), "Advance count",           step);
+            check(expired == expected,     "expired timers vs model", step);
+        }
+
+        check(wheel.Count() == model.size(), "Count vs model", step);
+    }
+}
+
+//------------------------------------------------------------------------------
+// Timers scheduled by a callback, for deadlines already past, expire on
+// the next Advance - Not in the one running.
+void test_schedule_from_callback()
+{
+    auto start = DateTime(2024, 1, 1, 0, 0, 0, 0);
+    auto wheel = Wheel(start, TimeSpan::FromTicks(k_resolution));
+    wheel.Schedule(TimeSpan::FromTicks(5 * k_resolution), 1);
+
+    auto fired = std::vector<std::uint64_t>();
+    wheel.Advance(start.AddTicks(10 * k_resolution), [&](std::uint64_t id) {
+        fired.push_back(id);
+        if(id == 1)
+            wheel.Schedule(start, 2);
+    });
+    check(fired == std::vector<std::uint64_t>{ 1 }, "callback timer waits", time_t(fired.size()));
+
+    wheel.Advance(start.AddTicks(10 * k_resolution), [&](std::uint64_t id) { fired.push_back(id); });
+    check(fired == std::vector<std::uint64_t>{ 1, 2 }, "callback timer expires next", time_t(fired.size()));
+    check(wheel.Count() == 0, "empty after expiring", time_t(wheel.Count()));
+}
+
+//------------------------------------------------------------------------------
+void test_resolution()
+{
+    auto start = DateTime(2024, 1, 1, 0, 0, 0, 0);
+    for(auto ticks : { time_t(0), time_t(-1), time_t(-TimeSpan::TicksPerSecond) })
+    {
+        auto threw = false;
+        try { Wheel(start, TimeSpan::FromTicks(ticks)); }
+        catch(const std::invalid_argument &) { threw = true; }
+
+        check(threw, "non positive resolution throws", ticks);
+    }
+
+    //--------------------------------------------------------------------------
+    // Deadlines are rounded up - Never early.
+    auto wheel = Wheel(start, TimeSpan::FromTicks(k_resolution));
+    wheel.Schedule(start.AddTicks(k_resolution + 1), 1);
+
+    auto fired = size_t(0);
+    fired += wheel.Advance(start.AddTicks(k_resolution),     [](std::uint64_t) {});
+    check(fired == 0, "not expired before the deadline", k_resolution);
+    fired += wheel.Advance(start.AddTicks(2 * k_resolution), [](std::uint64_t) {});
+    check(fired == 1, "expired at the rounded deadline", 2 * k_resolution);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+int main()
+{
+    test_against_model         ();
+    test_schedule_from_callback();
+    test_resolution            ();
+
+    if(g_failures != 0)
+    {
+        std::printf("%d failures\n", g_failures);
+        return 1;
+    }
+
+    std::printf("TimingWheel matches the multimap model\n");
+    return 0;
+}